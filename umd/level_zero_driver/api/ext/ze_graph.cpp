@@ -28,6 +28,21 @@
 
 namespace L0 {
 
+/**
+ * Resolves the graph handle and calls the graph method once the graph is created. Graph from
+ * zexGraphCreateAsync may still be created on the driver pool, its creation result is returned
+ * instead if the creation failed.
+ */
+template <typename Method, typename... Args>
+static ze_result_t callCreatedGraph(ze_graph_handle_t hGraph, Method method, Args... args) {
+    L0::Graph *graph = L0::Graph::fromHandle(hGraph);
+    ze_result_t ret = graph->waitForCreation();
+    if (ret != ZE_RESULT_SUCCESS)
+        return ret;
+
+    return (graph->*method)(args...);
+}
+
 ze_result_t ZE_APICALL zeGraphCreate(ze_context_handle_t hContext,
                                      ze_device_handle_t hDevice,
                                      const ze_graph_desc_t *pDesc,
@@ -83,7 +98,7 @@ ze_result_t ZE_APICALL zeGraphGetProperties(ze_graph_handle_t hGraph,
         goto exit;
     }
 
-    L0_HANDLE_EXCEPTION(ret, L0::Graph::fromHandle(hGraph)->getProperties(pGraphProperties));
+    L0_HANDLE_EXCEPTION(ret, callCreatedGraph(hGraph, &L0::Graph::getProperties, pGraphProperties));
 
 exit:
     trace_zeGraphGetProperties(ret, hGraph, pGraphProperties);
@@ -105,7 +120,8 @@ ze_result_t ZE_APICALL zeGraphGetProperties2(ze_graph_handle_t hGraph,
         goto exit;
     }
 
-    L0_HANDLE_EXCEPTION(ret, L0::Graph::fromHandle(hGraph)->getProperties2(pGraphProperties));
+    L0_HANDLE_EXCEPTION(ret,
+                        callCreatedGraph(hGraph, &L0::Graph::getProperties2, pGraphProperties));
 
 exit:
     trace_zeGraphGetProperties2(ret, hGraph, pGraphProperties);
@@ -124,9 +140,11 @@ zeGraphGetArgumentProperties(ze_graph_handle_t hGraph,
         goto exit;
     }
 
-    L0_HANDLE_EXCEPTION(
-        ret,
-        L0::Graph::fromHandle(hGraph)->getArgumentProperties(argIndex, pGraphArgumentProperties));
+    L0_HANDLE_EXCEPTION(ret,
+                        callCreatedGraph(hGraph,
+                                         &L0::Graph::getArgumentProperties,
+                                         argIndex,
+                                         pGraphArgumentProperties));
 
 exit:
     trace_zeGraphGetArgumentProperties(ret, hGraph, argIndex, pGraphArgumentProperties);
@@ -144,7 +162,11 @@ ze_result_t ZE_APICALL zeGraphSetArgumentValue(ze_graph_handle_t hGraph,
         goto exit;
     }
 
-    L0_HANDLE_EXCEPTION(ret, L0::Graph::fromHandle(hGraph)->setArgumentValue(argIndex, pArgValue));
+    L0_HANDLE_EXCEPTION(ret,
+                        callCreatedGraph(hGraph,
+                                         &L0::Graph::setArgumentValue,
+                                         argIndex,
+                                         pArgValue));
 
 exit:
     trace_zeGraphSetArgumentValue(ret, hGraph, argIndex, pArgValue);
@@ -222,7 +244,7 @@ ze_result_t ZE_APICALL zeGraphInitialize(ze_graph_handle_t hGraph) {
         goto exit;
     }
 
-    L0_HANDLE_EXCEPTION(ret, L0::Graph::fromHandle(hGraph)->parserInitialize());
+    L0_HANDLE_EXCEPTION(ret, callCreatedGraph(hGraph, &L0::Graph::parserInitialize));
 
 exit:
     trace_zeGraphInitialize(ret, hGraph);
@@ -319,7 +341,10 @@ ze_result_t ZE_APICALL zeGraphGetNativeBinary(ze_graph_handle_t hGraph,
     }
 
     L0_HANDLE_EXCEPTION(ret,
-                        L0::Graph::fromHandle(hGraph)->getNativeBinary(pSize, pGraphNativeBinary));
+                        callCreatedGraph(hGraph,
+                                         &L0::Graph::getNativeBinary,
+                                         pSize,
+                                         pGraphNativeBinary));
 
 exit:
     trace_zeGraphGetNativeBinary(ret, hGraph, pSize, pGraphNativeBinary);
@@ -348,7 +373,10 @@ ze_result_t ZE_APICALL zeGraphGetNativeBinary2(ze_graph_handle_t hGraph,
     }
 
     L0_HANDLE_EXCEPTION(ret,
-                        L0::Graph::fromHandle(hGraph)->getNativeBinary2(pSize, pGraphNativeBinary));
+                        callCreatedGraph(hGraph,
+                                         &L0::Graph::getNativeBinary2,
+                                         pSize,
+                                         pGraphNativeBinary));
 
 exit:
     trace_zeGraphGetNativeBinary2(ret, hGraph, pSize, pGraphNativeBinary);
@@ -414,9 +442,11 @@ zeGraphGetArgumentMetadata(ze_graph_handle_t hGraph,
         goto exit;
     }
 
-    L0_HANDLE_EXCEPTION(
-        ret,
-        L0::Graph::fromHandle(hGraph)->getArgumentMetadata(argIndex, pGraphArgumentMetadata));
+    L0_HANDLE_EXCEPTION(ret,
+                        callCreatedGraph(hGraph,
+                                         &L0::Graph::getArgumentMetadata,
+                                         argIndex,
+                                         pGraphArgumentMetadata));
 
 exit:
     trace_zeGraphGetArgumentMetadata(ret, hGraph, argIndex, pGraphArgumentMetadata);
@@ -435,9 +465,11 @@ zeGraphGetArgumentProperties2(ze_graph_handle_t hGraph,
         goto exit;
     }
 
-    L0_HANDLE_EXCEPTION(
-        ret,
-        L0::Graph::fromHandle(hGraph)->getArgumentProperties2(argIndex, pGraphArgumentProperties));
+    L0_HANDLE_EXCEPTION(ret,
+                        callCreatedGraph(hGraph,
+                                         &L0::Graph::getArgumentProperties2,
+                                         argIndex,
+                                         pGraphArgumentProperties));
 
 exit:
     trace_zeGraphGetArgumentProperties2(ret, hGraph, argIndex, pGraphArgumentProperties);
@@ -456,9 +488,11 @@ zeGraphGetArgumentProperties3(ze_graph_handle_t hGraph,
         goto exit;
     }
 
-    L0_HANDLE_EXCEPTION(
-        ret,
-        L0::Graph::fromHandle(hGraph)->getArgumentProperties3(argIndex, pGraphArgumentProperties));
+    L0_HANDLE_EXCEPTION(ret,
+                        callCreatedGraph(hGraph,
+                                         &L0::Graph::getArgumentProperties3,
+                                         argIndex,
+                                         pGraphArgumentProperties));
 
 exit:
     trace_zeGraphGetArgumentProperties3(ret, hGraph, argIndex, pGraphArgumentProperties);
@@ -540,8 +574,8 @@ ze_result_t ZE_APICALL zeGraphBuildLogGetString(ze_graph_handle_t hGraph,
     ze_result_t ret;
 
     if (hGraph != nullptr) {
-        // Case when the graph creation was successful, no logs from compiler
-        ret = ZE_RESULT_SUCCESS;
+        // Log of an asynchronously created graph, empty for a graph created synchronously
+        L0_HANDLE_EXCEPTION(ret, L0::Graph::fromHandle(hGraph)->getCreateLog(pSize, pBuildLog));
         goto exit;
     }
 
@@ -648,7 +682,10 @@ zeGraphProfilingPoolCreate(ze_graph_handle_t hGraph,
     }
 
     L0_HANDLE_EXCEPTION(ret,
-                        L0::Graph::fromHandle(hGraph)->createProfilingPool(count, phProfilingPool));
+                        callCreatedGraph(hGraph,
+                                         &L0::Graph::createProfilingPool,
+                                         count,
+                                         phProfilingPool));
 
 exit:
     trace_zeGraphProfilingPoolCreate(ret, hGraph, count, phProfilingPool);
@@ -913,7 +950,8 @@ ze_result_t ZE_APICALL zeGraphGetProperties3(ze_graph_handle_t hGraph,
         goto exit;
     }
 
-    L0_HANDLE_EXCEPTION(ret, L0::Graph::fromHandle(hGraph)->getProperties3(pGraphProperties));
+    L0_HANDLE_EXCEPTION(ret,
+                        callCreatedGraph(hGraph, &L0::Graph::getProperties3, pGraphProperties));
 
 exit:
     trace_zeGraphGetProperties3(ret, hGraph, pGraphProperties);
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero_driver/api/prv/zex_context.hpp"
+
+#include "level_zero_driver/api/zet_misc.hpp"
+#include "level_zero_driver/source/context.hpp"
+#include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_cache.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_counters.hpp"
+#include "vpu_driver/source/memory/vpu_shared_buffers.hpp"
+
+static_assert(static_cast<int>(ZEX_MEMORY_LOCATION_COUNT) ==
+                  static_cast<int>(VPU::VPUBufferCounters::LOCATION_COUNT),
+              "Memory location count mismatch");
+static_assert(static_cast<int>(ZEX_MEMORY_TYPE_COUNT) ==
+                  static_cast<int>(VPU::VPUBufferCounters::TYPE_COUNT),
+              "Memory type count mismatch");
+
+static void copyCounter(const VPU::VPUBufferCounters::Usage &usage,
+                        zex_memory_counter_t &counter) {
+    counter.allocated = usage.size;
+    counter.count = usage.count;
+    counter.allocatedPeak = usage.peakSize;
+    counter.countPeak = usage.peakCount;
+}
+
+extern "C" {
+ze_result_t ZE_APICALL zexContextGetMemoryUsage(ze_context_handle_t hContext,
+                                                zex_memory_usage_t *pUsage) {
+    if (hContext == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    if (pUsage == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    ze_result_t ret = L0::translateHandle(ZEL_HANDLE_CONTEXT, hContext);
+    if (ret != ZE_RESULT_SUCCESS)
+        return ret;
+
+    auto *ctx = L0::Context::fromHandle(hContext)->getDeviceContext();
+    auto &counters = ctx->getBufferCounters();
+    copyCounter(counters.getTotal(), pUsage->total);
+    for (size_t i = 0; i < VPU::VPUBufferCounters::LOCATION_COUNT; i++)
+        copyCounter(
+            counters.getByLocation(static_cast<VPU::VPUBufferCounters::LocationIndex>(i)),
+            pUsage->location[i]);
+    for (size_t i = 0; i < VPU::VPUBufferCounters::TYPE_COUNT; i++)
+        copyCounter(counters.getByType(static_cast<VPU::VPUBufferCounters::TypeIndex>(i)),
+                    pUsage->type[i]);
+    copyCounter(ctx->getBufferCache().getUsage(), pUsage->cached);
+
+    auto shared = ctx->getSharedBuffers().getStats();
+    pUsage->sharedCount = shared.count;
+    pUsage->sharedAllocated = shared.size;
+    pUsage->sharedSaved = shared.savedSize;
+    return ZE_RESULT_SUCCESS;
+}
+}
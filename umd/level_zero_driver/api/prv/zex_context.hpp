@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <level_zero/ze_api.h>
+
+extern "C" {
+typedef enum _zex_memory_location_t {
+    ZEX_MEMORY_LOCATION_INTERNAL = 0,
+    ZEX_MEMORY_LOCATION_HOST,
+    ZEX_MEMORY_LOCATION_DEVICE,
+    ZEX_MEMORY_LOCATION_SHARED,
+    ZEX_MEMORY_LOCATION_COUNT,
+} zex_memory_location_t;
+
+typedef enum _zex_memory_type_t {
+    ZEX_MEMORY_TYPE_CACHED_FW = 0,
+    ZEX_MEMORY_TYPE_CACHED_SHAVE,
+    ZEX_MEMORY_TYPE_CACHED_DMA,
+    ZEX_MEMORY_TYPE_UNCACHED_FW,
+    ZEX_MEMORY_TYPE_UNCACHED_SHAVE,
+    ZEX_MEMORY_TYPE_UNCACHED_DMA,
+    ZEX_MEMORY_TYPE_WRITE_COMBINE_FW,
+    ZEX_MEMORY_TYPE_WRITE_COMBINE_SHAVE,
+    ZEX_MEMORY_TYPE_WRITE_COMBINE_DMA,
+    ZEX_MEMORY_TYPE_IMPORTED,
+    ZEX_MEMORY_TYPE_COUNT,
+} zex_memory_type_t;
+
+typedef struct _zex_memory_counter_t {
+    uint64_t allocated;     ///< Currently allocated bytes
+    uint64_t count;         ///< Currently allocated buffers
+    uint64_t allocatedPeak; ///< High-water mark of allocated bytes
+    uint64_t countPeak;     ///< High-water mark of allocated buffers
+} zex_memory_counter_t;
+
+typedef struct _zex_memory_usage_t {
+    zex_memory_counter_t total;
+    zex_memory_counter_t location[ZEX_MEMORY_LOCATION_COUNT];
+    zex_memory_counter_t type[ZEX_MEMORY_TYPE_COUNT];
+    zex_memory_counter_t cached; ///< Released buffers kept for reuse, not included in total
+    uint64_t sharedCount;        ///< Graph sections shared between graphs, included in total
+    uint64_t sharedAllocated;    ///< Bytes of graph sections shared between graphs
+    uint64_t sharedSaved;        ///< Bytes graphs would have allocated without the sharing
+} zex_memory_usage_t;
+
+ze_result_t ZE_APICALL zexContextGetMemoryUsage(ze_context_handle_t hContext,
+                                                zex_memory_usage_t *pUsage);
+}
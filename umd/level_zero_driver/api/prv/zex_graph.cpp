@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero_driver/api/prv/zex_graph.hpp"
+
+#include "level_zero_driver/api/zet_misc.hpp"
+#include "level_zero_driver/include/l0_exception.hpp"
+#include "level_zero_driver/source/ext/graph.hpp"
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <exception>
+
+extern "C" {
+ze_result_t ZE_APICALL zexGraphCreateAsync(ze_context_handle_t hContext,
+                                           ze_device_handle_t hDevice,
+                                           const ze_graph_desc_2_t *pDesc,
+                                           ze_event_handle_t hSignalEvent,
+                                           ze_graph_handle_t *phGraph) {
+    if (hDevice == nullptr || hContext == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+
+    ze_result_t ret = L0::translateHandle(ZEL_HANDLE_CONTEXT, hContext);
+    if (ret != ZE_RESULT_SUCCESS)
+        return ret;
+
+    ret = L0::translateHandle(ZEL_HANDLE_DEVICE, hDevice);
+    if (ret != ZE_RESULT_SUCCESS)
+        return ret;
+
+    if (hSignalEvent != nullptr) {
+        ret = L0::translateHandle(ZEL_HANDLE_EVENT, hSignalEvent);
+        if (ret != ZE_RESULT_SUCCESS)
+            return ret;
+    }
+
+    L0_HANDLE_EXCEPTION_AND_RETURN(
+        L0::Graph::createAsync(hContext, hDevice, pDesc, hSignalEvent, phGraph));
+}
+}
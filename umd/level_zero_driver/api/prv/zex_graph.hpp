@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <level_zero/ze_api.h>
+#include <level_zero/ze_graph_ext.h>
+
+extern "C" {
+/**
+ * Asynchronous variant of zeGraphCreate2. Returns the graph handle immediately, compilation or
+ * cache lookup, parsing and loading of the graph run on the driver worker pool. hSignalEvent
+ * (optional) is signaled once the creation is finished, also when it failed. The event does not
+ * report the result, it has to be checked with any graph call, e.g. zeGraphGetProperties2. Graph
+ * calls made before that block until the creation is finished and return its result. The log
+ * of the creation is returned by zeGraphBuildLogGetString called with the graph handle. The
+ * descriptor input and its pNext chain have to stay valid until the event is signaled.
+ */
+ze_result_t ZE_APICALL zexGraphCreateAsync(ze_context_handle_t hContext,
+                                           ze_device_handle_t hDevice,
+                                           const ze_graph_desc_2_t *pDesc,
+                                           ze_event_handle_t hSignalEvent,
+                                           ze_graph_handle_t *phGraph);
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <level_zero/ze_api.h>
+
+extern "C" {
+#define ZEX_STRUCTURE_TYPE_MEM_ALLOC_PREFAULT_DESC static_cast<ze_structure_type_t>(0x7ff00001)
+
+/**
+ * Chained to ze_host_mem_alloc_desc_t or ze_device_mem_alloc_desc_t to pre-fault the host
+ * mapping of the allocation, the first host access to the memory does not take page faults.
+ */
+typedef struct _zex_mem_alloc_prefault_desc_t {
+    ze_structure_type_t stype; ///< [in] ZEX_STRUCTURE_TYPE_MEM_ALLOC_PREFAULT_DESC
+    const void *pNext;         ///< [in][optional] pointer to extension-specific structure
+} zex_mem_alloc_prefault_desc_t;
+}
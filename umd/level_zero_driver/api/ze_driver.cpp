@@ -11,7 +11,9 @@
 
 #include "level_zero_driver/api/ext/ze_graph.hpp"
 #include "level_zero_driver/api/ext/ze_queue.hpp"
+#include "level_zero_driver/api/prv/zex_context.hpp"
 #include "level_zero_driver/api/prv/zex_driver.hpp"
+#include "level_zero_driver/api/prv/zex_graph.hpp"
 #include "level_zero_driver/api/trace/trace_ze_api.hpp"
 #include "level_zero_driver/api/trace/trace_ze_api_ddi.hpp"
 #include "level_zero_driver/include/l0_exception.hpp"
@@ -288,6 +290,8 @@ ze_result_t zeDriverGetExtensionFunctionAddress(ze_driver_handle_t hDriver,
     CHECK_PRIVATE_FUNCTION(zexDiskCacheSetSize);
     CHECK_PRIVATE_FUNCTION(zexDiskCacheGetSize);
     CHECK_PRIVATE_FUNCTION(zexDiskCacheGetDirectory);
+    CHECK_PRIVATE_FUNCTION(zexContextGetMemoryUsage);
+    CHECK_PRIVATE_FUNCTION(zexGraphCreateAsync);
 
     LOG_E("Driver Function Extension with %s name does not exist", name);
 exit:
@@ -7,6 +7,7 @@
 
 #include <stddef.h>
 
+#include "level_zero_driver/api/prv/zex_memory.hpp"
 #include "level_zero_driver/api/trace/trace_ze_api.hpp"
 #include "level_zero_driver/api/trace/trace_ze_api_ddi.hpp"
 #include "level_zero_driver/include/l0_exception.hpp"
@@ -31,6 +32,36 @@ static VPU::VPUBufferObject::Type flagToBufferObjectType(ze_host_mem_alloc_flags
     return VPU::VPUBufferObject::Type::CachedDma;
 }
 
+struct MemAllocExtensions {
+    const ze_external_memory_export_desc_t *exportDesc = nullptr;
+    const ze_external_memory_import_fd_t *importDesc = nullptr;
+    bool prefault = false;
+};
+
+static bool parseMemAllocExtensions(const void *pNext, MemAllocExtensions &ext) {
+    while (pNext != nullptr) {
+        if (!checkPtrAlignment<const ze_base_desc_t *>(pNext))
+            return false;
+
+        auto *desc = reinterpret_cast<const ze_base_desc_t *>(pNext);
+        switch (desc->stype) {
+        case ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_DESC:
+            ext.exportDesc = reinterpret_cast<const ze_external_memory_export_desc_t *>(desc);
+            break;
+        case ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMPORT_FD:
+            ext.importDesc = reinterpret_cast<const ze_external_memory_import_fd_t *>(desc);
+            break;
+        case ZEX_STRUCTURE_TYPE_MEM_ALLOC_PREFAULT_DESC:
+            ext.prefault = true;
+            break;
+        default:
+            break;
+        }
+        pNext = desc->pNext;
+    }
+    return true;
+}
+
 ze_result_t zeMemAllocShared(ze_context_handle_t hContext,
                              const ze_device_mem_alloc_desc_t *deviceDesc,
                              const ze_host_mem_alloc_desc_t *hostDesc,
@@ -39,7 +70,8 @@ ze_result_t zeMemAllocShared(ze_context_handle_t hContext,
                              ze_device_handle_t hDevice,
                              void **pptr) {
     trace_zeMemAllocShared(hContext, deviceDesc, hostDesc, size, alignment, hDevice, pptr);
-    ze_structure_type_t extendedAllocType = ZE_STRUCTURE_TYPE_FORCE_UINT32;
+    MemAllocExtensions ext = {};
+    MemAllocExtensions hostExt = {};
     ze_result_t ret;
 
     if (hContext == nullptr) {
@@ -48,58 +80,50 @@ ze_result_t zeMemAllocShared(ze_context_handle_t hContext,
     }
 
     if (deviceDesc == nullptr || hostDesc == nullptr ||
-        (deviceDesc->pNext && !checkPtrAlignment<ze_structure_type_t *>(deviceDesc->pNext))) {
+        !parseMemAllocExtensions(deviceDesc->pNext, ext) ||
+        !parseMemAllocExtensions(hostDesc->pNext, hostExt)) {
         ret = ZE_RESULT_ERROR_INVALID_NULL_POINTER;
         goto exit;
     }
 
-    if (deviceDesc->pNext)
-        extendedAllocType = *reinterpret_cast<const ze_structure_type_t *>(deviceDesc->pNext);
+    // Only the device descriptor chain carries external memory descriptors
+    ext.prefault = ext.prefault || hostExt.prefault;
 
     /* For alloc exportable buffer single ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF flag is supported,
      * combination  flags not allowed
      */
-    switch (extendedAllocType) {
-    case ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_DESC: {
-        const ze_external_memory_export_desc_t *pExtMemDesc =
-            reinterpret_cast<const ze_external_memory_export_desc_t *>(deviceDesc->pNext);
-
-        if (pExtMemDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
+    if (ext.exportDesc != nullptr) {
+        if (ext.exportDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
             L0_HANDLE_EXCEPTION(ret,
                                 L0::Context::fromHandle(hContext)->allocMemory(
                                     size,
                                     alignment,
                                     pptr,
                                     VPU::VPUBufferObject::Location::ExternalShared,
-                                    flagToBufferObjectType(hostDesc->flags)));
+                                    flagToBufferObjectType(hostDesc->flags),
+                                    ext.prefault));
             goto exit;
         }
         ret = ZE_RESULT_ERROR_INVALID_ENUMERATION;
-        break;
-    }
-    case ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMPORT_FD: {
-        const ze_external_memory_import_fd_t *pImportMemDesc =
-            reinterpret_cast<const ze_external_memory_import_fd_t *>(deviceDesc->pNext);
-        if (pImportMemDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
+    } else if (ext.importDesc != nullptr) {
+        if (ext.importDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
             L0_HANDLE_EXCEPTION(ret,
                                 L0::Context::fromHandle(hContext)->importMemory(
                                     VPU::VPUBufferObject::Location::ExternalShared,
-                                    pImportMemDesc->fd,
+                                    ext.importDesc->fd,
                                     pptr));
             goto exit;
         }
         ret = ZE_RESULT_ERROR_INVALID_ENUMERATION;
-        break;
-    }
-    default:
+    } else {
         L0_HANDLE_EXCEPTION(ret,
                             L0::Context::fromHandle(hContext)->allocMemory(
                                 size,
                                 alignment,
                                 pptr,
                                 VPU::VPUBufferObject::Location::Shared,
-                                flagToBufferObjectType(hostDesc->flags)));
-        break;
+                                flagToBufferObjectType(hostDesc->flags),
+                                ext.prefault));
     }
 
 exit:
@@ -114,7 +138,7 @@ ze_result_t zeMemAllocDevice(ze_context_handle_t hContext,
                              ze_device_handle_t hDevice,
                              void **pptr) {
     trace_zeMemAllocDevice(hContext, deviceDesc, size, alignment, hDevice, pptr);
-    ze_structure_type_t extendedAllocType = ZE_STRUCTURE_TYPE_FORCE_UINT32;
+    MemAllocExtensions ext = {};
     ze_result_t ret;
 
     if (hContext == nullptr) {
@@ -122,59 +146,46 @@ ze_result_t zeMemAllocDevice(ze_context_handle_t hContext,
         goto exit;
     }
 
-    if (deviceDesc == nullptr ||
-        (deviceDesc->pNext && !checkPtrAlignment<ze_structure_type_t *>(deviceDesc->pNext))) {
+    if (deviceDesc == nullptr || !parseMemAllocExtensions(deviceDesc->pNext, ext)) {
         ret = ZE_RESULT_ERROR_INVALID_NULL_POINTER;
         goto exit;
     }
 
-    if (deviceDesc->pNext)
-        extendedAllocType = *reinterpret_cast<const ze_structure_type_t *>(deviceDesc->pNext);
-
     /* For alloc exportable buffer single ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF flag is supported,
      * combination  flags not allowed
      */
-    switch (extendedAllocType) {
-    case ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_DESC: {
-        const ze_external_memory_export_desc_t *pExtMemDesc =
-            reinterpret_cast<const ze_external_memory_export_desc_t *>(deviceDesc->pNext);
-
-        if (pExtMemDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
+    if (ext.exportDesc != nullptr) {
+        if (ext.exportDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
             L0_HANDLE_EXCEPTION(ret,
                                 L0::Context::fromHandle(hContext)->allocMemory(
                                     size,
                                     alignment,
                                     pptr,
                                     VPU::VPUBufferObject::Location::ExternalDevice,
-                                    VPU::VPUBufferObject::Type::WriteCombineDma));
+                                    VPU::VPUBufferObject::Type::WriteCombineDma,
+                                    ext.prefault));
             goto exit;
         }
         ret = ZE_RESULT_ERROR_INVALID_ENUMERATION;
-        break;
-    }
-    case ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMPORT_FD: {
-        const ze_external_memory_import_fd_t *pImportMemDesc =
-            reinterpret_cast<const ze_external_memory_import_fd_t *>(deviceDesc->pNext);
-        if (pImportMemDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
+    } else if (ext.importDesc != nullptr) {
+        if (ext.importDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
             L0_HANDLE_EXCEPTION(ret,
                                 L0::Context::fromHandle(hContext)->importMemory(
                                     VPU::VPUBufferObject::Location::ExternalDevice,
-                                    pImportMemDesc->fd,
+                                    ext.importDesc->fd,
                                     pptr));
             goto exit;
         }
         ret = ZE_RESULT_ERROR_INVALID_ENUMERATION;
-        break;
-    }
-    default:
+    } else {
         L0_HANDLE_EXCEPTION(ret,
                             L0::Context::fromHandle(hContext)->allocMemory(
                                 size,
                                 alignment,
                                 pptr,
                                 VPU::VPUBufferObject::Location::Device,
-                                VPU::VPUBufferObject::Type::WriteCombineDma));
-        break;
+                                VPU::VPUBufferObject::Type::WriteCombineDma,
+                                ext.prefault));
     }
 
 exit:
@@ -188,7 +199,7 @@ ze_result_t zeMemAllocHost(ze_context_handle_t hContext,
                            size_t alignment,
                            void **pptr) {
     trace_zeMemAllocHost(hContext, hostDesc, size, alignment, pptr);
-    ze_structure_type_t extendedAllocType = ZE_STRUCTURE_TYPE_FORCE_UINT32;
+    MemAllocExtensions ext = {};
     ze_result_t ret;
 
     if (hContext == nullptr) {
@@ -196,59 +207,46 @@ ze_result_t zeMemAllocHost(ze_context_handle_t hContext,
         goto exit;
     }
 
-    if (hostDesc == nullptr ||
-        (hostDesc->pNext && !checkPtrAlignment<ze_structure_type_t *>(hostDesc->pNext))) {
+    if (hostDesc == nullptr || !parseMemAllocExtensions(hostDesc->pNext, ext)) {
         ret = ZE_RESULT_ERROR_INVALID_NULL_POINTER;
         goto exit;
     }
 
-    if (hostDesc->pNext)
-        extendedAllocType = *reinterpret_cast<const ze_structure_type_t *>(hostDesc->pNext);
-
     /* For alloc exportable buffer single ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF flag is supported,
      * combination  flags not allowed
      */
-    switch (extendedAllocType) {
-    case ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_DESC: {
-        const ze_external_memory_export_desc_t *pExtMemDesc =
-            reinterpret_cast<const ze_external_memory_export_desc_t *>(hostDesc->pNext);
-
-        if (pExtMemDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
+    if (ext.exportDesc != nullptr) {
+        if (ext.exportDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
             L0_HANDLE_EXCEPTION(ret,
                                 L0::Context::fromHandle(hContext)->allocMemory(
                                     size,
                                     alignment,
                                     pptr,
                                     VPU::VPUBufferObject::Location::ExternalHost,
-                                    flagToBufferObjectType(hostDesc->flags)));
+                                    flagToBufferObjectType(hostDesc->flags),
+                                    ext.prefault));
             goto exit;
         }
         ret = ZE_RESULT_ERROR_INVALID_ENUMERATION;
-        break;
-    }
-    case ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMPORT_FD: {
-        const ze_external_memory_import_fd_t *pImportMemDesc =
-            reinterpret_cast<const ze_external_memory_import_fd_t *>(hostDesc->pNext);
-        if (pImportMemDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
+    } else if (ext.importDesc != nullptr) {
+        if (ext.importDesc->flags == ZE_EXTERNAL_MEMORY_TYPE_FLAG_DMA_BUF) {
             L0_HANDLE_EXCEPTION(ret,
                                 L0::Context::fromHandle(hContext)->importMemory(
                                     VPU::VPUBufferObject::Location::ExternalHost,
-                                    pImportMemDesc->fd,
+                                    ext.importDesc->fd,
                                     pptr));
             goto exit;
         }
         ret = ZE_RESULT_ERROR_INVALID_ENUMERATION;
-        break;
-    }
-    default:
+    } else {
         L0_HANDLE_EXCEPTION(ret,
                             L0::Context::fromHandle(hContext)->allocMemory(
                                 size,
                                 alignment,
                                 pptr,
                                 VPU::VPUBufferObject::Location::Host,
-                                flagToBufferObjectType(hostDesc->flags)));
-        break;
+                                flagToBufferObjectType(hostDesc->flags),
+                                ext.prefault));
     }
 
 exit:
@@ -23,9 +23,12 @@
 #include "vpu_driver/source/device/hw_info.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/memory/vpu_slab_allocator.hpp"
 
+#include <atomic>
 #include <level_zero/ze_api.h>
 #include <level_zero/ze_graph_ext.h>
+#include <mutex>
 #include <optional>
 #include <string.h>
 #include <type_traits>
@@ -36,7 +39,13 @@ CommandList::CommandList(Context *pContext, bool isMutable)
     : pContext(pContext)
     , isMutable(isMutable)
     , ctx(pContext->getDeviceContext())
-    , vpuJob(std::make_shared<VPU::VPUJob>(ctx)) {}
+    , vpuJob(std::make_shared<VPU::VPUJob>(ctx))
+    , version(nextVersion()) {}
+
+uint64_t CommandList::nextVersion() {
+    static std::atomic<uint64_t> lastVersion = 0;
+    return ++lastVersion;
+}
 
 ze_result_t CommandList::create(ze_context_handle_t hContext,
                                 ze_device_handle_t hDevice,
@@ -94,6 +103,7 @@ ze_result_t CommandList::isImmediate(ze_bool_t *pIsImmediate) {
 }
 
 ze_result_t CommandList::destroy() {
+    pContext->dropFusedJobs(this);
     pContext->removeObject(this);
     LOG(CMDLIST, "CommandList destroyed");
     return ZE_RESULT_SUCCESS;
@@ -110,11 +120,22 @@ ze_result_t CommandList::close() {
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 
+    version = nextVersion();
     return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t CommandList::reset() {
-    vpuJob = std::make_shared<VPU::VPUJob>(ctx);
+    // Fused jobs with the previous commands can not be submitted anymore
+    pContext->dropFusedJobs(this);
+
+    // Command buffer storage is reused only if the job is not tracked by a queue or fence, those
+    // would wait on the buffer objects that are going to be submitted again
+    std::vector<std::shared_ptr<VPU::VPUBufferObject>> spareBuffers;
+    if (vpuJob.use_count() == 1)
+        spareBuffers = vpuJob->takeCommandBufferStorage();
+
+    vpuJob = std::make_shared<VPU::VPUJob>(ctx, std::move(spareBuffers));
+    version = nextVersion();
     return ZE_RESULT_SUCCESS;
 }
 
@@ -253,6 +274,7 @@ ze_result_t CommandList::appendMemoryFillAsCopyCmd(void *ptr,
                                                    ze_event_handle_t hSignalEvent,
                                                    uint32_t numWaitEvents,
                                                    ze_event_handle_t *phWaitEvents) {
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
     ze_result_t result = checkCommandAppendCondition();
     if (result != ZE_RESULT_SUCCESS)
         return result;
@@ -310,18 +332,20 @@ ze_result_t CommandList::appendWriteGlobalTimestamp(uint64_t *dstptr,
         return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
     }
 
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
     ze_result_t result = checkCommandAppendCondition();
     if (result != ZE_RESULT_SUCCESS)
         return result;
 
-    auto alignedBo =
-        ctx->createUntrackedBufferObject(sizeof(uint64_t), VPU::VPUBufferObject::Type::CachedFw);
+    auto alignedChunk =
+        ctx->createUntrackedBufferChunk(sizeof(uint64_t), VPU::VPUBufferObject::Type::CachedFw);
 
-    if (alignedBo == nullptr) {
+    if (alignedChunk == nullptr) {
         LOG_E("Failed to allocate memory");
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
     }
-    memset(alignedBo->getBasePointer(), 0, sizeof(uint64_t));
+    auto alignedBo = alignedChunk->getBufferObject();
+    auto *alignedPtr = alignedChunk->getBasePointer();
 
     if (numWaitEvents > 0) {
         if (phWaitEvents == nullptr) {
@@ -338,16 +362,15 @@ ze_result_t CommandList::appendWriteGlobalTimestamp(uint64_t *dstptr,
         }
     }
 
-    result = appendCommand<VPU::VPUTimeStampCommand>(
-        reinterpret_cast<uint64_t *>(alignedBo->getBasePointer()),
-        alignedBo,
-        ctx->getFwTimestampType());
+    result = appendCommand<VPU::VPUTimeStampCommand>(reinterpret_cast<uint64_t *>(alignedPtr),
+                                                     alignedBo,
+                                                     ctx->getFwTimestampType());
 
     if (result != ZE_RESULT_SUCCESS)
         return result;
 
     result = appendCommand<VPU::VPUCopyCommand>(ctx,
-                                                alignedBo->getBasePointer(),
+                                                alignedPtr,
                                                 alignedBo,
                                                 dstptr,
                                                 std::move(dstBo),
@@ -372,6 +395,7 @@ ze_result_t CommandList::appendGraphInitialize(ze_graph_handle_t hGraph,
                                                ze_event_handle_t hSignalEvent,
                                                uint32_t numWaitEvents,
                                                ze_event_handle_t *phWaitEvents) {
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
     ze_result_t result = checkCommandAppendCondition();
     if (result != ZE_RESULT_SUCCESS)
         return result;
@@ -397,6 +421,10 @@ ze_result_t CommandList::appendGraphInitialize(ze_graph_handle_t hGraph,
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
+    result = graph->waitForCreation();
+    if (result != ZE_RESULT_SUCCESS)
+        return result;
+
     auto cmd = graph->allocateGraphInitCommand(ctx);
     if (cmd == nullptr) {
         LOG_E("Graph-Initialize Command failed to be initialized!");
@@ -427,6 +455,7 @@ ze_result_t CommandList::appendGraphExecute(ze_graph_handle_t hGraph,
                                             ze_event_handle_t hSignalEvent,
                                             uint32_t numWaitEvents,
                                             ze_event_handle_t *phWaitEvents) {
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
     ze_result_t result = checkCommandAppendCondition();
     if (result != ZE_RESULT_SUCCESS)
         return result;
@@ -460,6 +489,10 @@ ze_result_t CommandList::appendGraphExecute(ze_graph_handle_t hGraph,
         return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
     }
 
+    result = graph->waitForCreation();
+    if (result != ZE_RESULT_SUCCESS)
+        return result;
+
     GraphProfilingQuery *profilingQuery = nullptr;
     if (graph->getProfilingOutputSize()) {
         profilingQuery = GraphProfilingQuery::fromHandle(hProfilingQuery);
@@ -495,6 +528,7 @@ ze_result_t CommandList::appendGraphExecute(ze_graph_handle_t hGraph,
 }
 
 ze_result_t CommandList::appendSignalEvent(ze_event_handle_t hEvent) {
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
     ze_result_t result = checkCommandAppendCondition();
     if (result != ZE_RESULT_SUCCESS)
         return result;
@@ -527,6 +561,7 @@ ze_result_t CommandList::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_
     if (numEvents == 0u)
         return ZE_RESULT_ERROR_INVALID_SIZE;
 
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
     ze_result_t result = checkCommandAppendCondition();
     if (result != ZE_RESULT_SUCCESS)
         return result;
@@ -554,6 +589,7 @@ ze_result_t CommandList::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_
 }
 
 ze_result_t CommandList::appendEventReset(ze_event_handle_t hEvent) {
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
     ze_result_t result = checkCommandAppendCondition();
     if (result != ZE_RESULT_SUCCESS)
         return result;
@@ -591,6 +627,7 @@ ze_result_t CommandList::appendMetricQueryBegin(zet_metric_query_handle_t hMetri
         return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
     }
 
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
     ze_result_t result = checkCommandAppendCondition();
     if (result != ZE_RESULT_SUCCESS)
         return result;
@@ -756,6 +793,7 @@ ze_result_t CommandList::updateMutableCommands(const ze_mutable_commands_exp_des
     }
 
     vpuJob->setNeedsUpdate(true);
+    version = nextVersion();
 
     return ZE_RESULT_SUCCESS;
 }
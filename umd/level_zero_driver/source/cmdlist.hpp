@@ -20,6 +20,7 @@
 #include <level_zero/ze_graph_profiling_ext.h>
 #include <level_zero/zet_api.h>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -109,6 +110,12 @@ struct CommandList : _ze_command_list_handle_t, IContextObject {
     }
     std::shared_ptr<VPU::VPUJob> getJob() const { return vpuJob; }
 
+    /**
+     * Version changes whenever the job of the list is closed, updated or reset. It is unique
+     * among all command lists.
+     */
+    uint64_t getVersion() const { return version; }
+
   protected:
     ze_result_t appendMemoryFillCmd(void *ptr,
                                     const void *pattern,
@@ -154,6 +161,7 @@ struct CommandList : _ze_command_list_handle_t, IContextObject {
                                         uint32_t numWaitEvents,
                                         ze_event_handle_t *phWaitEvents,
                                         Args &&...args) {
+        const std::lock_guard<std::recursive_mutex> lock(appendMutex);
         ze_result_t result = checkCommandAppendCondition();
         if (result != ZE_RESULT_SUCCESS)
             return result;
@@ -200,8 +208,15 @@ struct CommandList : _ze_command_list_handle_t, IContextObject {
     bool isMutable = false;
     VPU::VPUDeviceContext *ctx = nullptr;
     std::shared_ptr<VPU::VPUJob> vpuJob = nullptr;
+    // Held while commands are appended, pending batch of immediate command list might be
+    // submitted by another thread
+    std::recursive_mutex appendMutex;
     std::vector<VPU::VPUBufferObject *> tracedInternalBos;
     std::unordered_map<uint64_t, uint64_t> commandIdMap;
+    uint64_t version = 0;
+
+  private:
+    static uint64_t nextVersion();
 };
 
 } // namespace L0
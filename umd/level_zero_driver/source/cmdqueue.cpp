@@ -12,15 +12,19 @@
 #include "cmdlist.hpp"
 #include "context.hpp"
 #include "device.hpp"
+#include "driver.hpp"
 #include "fence.hpp"
 #include "level_zero/ze_api.h"
 #include "level_zero_driver/include/l0_exception.hpp"
 #include "vpu_driver/source/command/vpu_job.hpp"
+#include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_cache.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 #include "vpu_driver/source/utilities/timer.hpp"
 
 #include <algorithm>
 #include <chrono> // IWYU pragma: keep
+#include <cstddef>
 #include <errno.h>
 #include <iterator>
 #include <limits>
@@ -102,6 +106,12 @@ ze_result_t CommandQueue::create(ze_context_handle_t hContext,
             std::move(vpuQueue),
             desc->mode == ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS ? CommandQueueMode::SYNCHRONOUS
                                                             : CommandQueueMode::DEFAULT);
+        Driver *pDriver = Driver::getInstance();
+        if (pDriver && pDriver->getEnvVariables().asyncSubmit)
+            cmdQueue->enableAsyncSubmission();
+        if (pDriver && pDriver->getEnvVariables().fuseCommandLists)
+            cmdQueue->enableCommandListFusion();
+
         *phCommandQueue = cmdQueue.get();
         pContext->appendObject(std::move(cmdQueue));
         LOG(CMDQUEUE, "CommandQueue created - %p", *phCommandQueue);
@@ -178,6 +188,7 @@ ze_result_t CommandQueue::executeCommandLists(uint32_t nCommandLists,
     }
 
     std::vector<std::shared_ptr<VPU::VPUJob>> jobs;
+    Context::FusedJobKey fusedJobKey;
     for (auto i = 0u; i < nCommandLists; i++) {
         auto cmdList = CommandList::fromHandle(phCommandLists[i]);
         if (cmdList == nullptr) {
@@ -196,6 +207,24 @@ ze_result_t CommandQueue::executeCommandLists(uint32_t nCommandLists,
             return ZE_RESULT_ERROR_UNKNOWN;
         }
 
+        if (fuseCommandLists)
+            fusedJobKey.emplace_back(cmdList, cmdList->getVersion());
+        jobs.emplace_back(std::move(job));
+    }
+
+    if (fuseCommandLists && jobs.size() > 1) {
+        auto fusedJob = getFusedJob(fusedJobKey, jobs);
+        if (fusedJob)
+            jobs = {std::move(fusedJob)};
+    }
+
+    for (const auto &job : jobs) {
+        if (submitWorker) {
+            submitWorker->enqueue(job);
+            LOG(CMDQUEUE, "VPUJob %p queued for submission", job.get());
+            continue;
+        }
+
         if (!vpuQueue->submit(job.get())) {
             LOG_E("VPUJob submission failed");
             if (errno == -EBADFD)
@@ -204,7 +233,6 @@ ze_result_t CommandQueue::executeCommandLists(uint32_t nCommandLists,
         }
 
         LOG(CMDQUEUE, "VPUJob %p submitted", job.get());
-        jobs.emplace_back(std::move(job));
     }
 
     if (hFence != nullptr) {
@@ -226,10 +254,33 @@ ze_result_t CommandQueue::executeCommandLists(uint32_t nCommandLists,
     return ZE_RESULT_SUCCESS;
 }
 
+std::shared_ptr<VPU::VPUJob>
+CommandQueue::getFusedJob(const Context::FusedJobKey &key,
+                          const std::vector<std::shared_ptr<VPU::VPUJob>> &jobs) {
+    std::shared_ptr<VPU::VPUJob> fusedJob = pContext->takeFusedJob(key);
+    if (fusedJob == nullptr) {
+        fusedJob = VPU::VPUJob::createFused(pContext->getDeviceContext(), jobs);
+        if (fusedJob == nullptr) {
+            LOG_W("Failed to fuse %zu command lists, submitting them separately", jobs.size());
+            return nullptr;
+        }
+    }
+
+    // Event waits look up command buffers of the fused job through the command list jobs
+    for (const auto &job : jobs)
+        job->setFusedJob(fusedJob);
+
+    pContext->putFusedJob(key, fusedJob);
+    LOG(CMDQUEUE, "Command lists fused into VPUJob %p", fusedJob.get());
+    return fusedJob;
+}
+
 ze_result_t CommandQueue::synchronize(uint64_t timeout) {
     LOG(CMDQUEUE, "CommandQueue synchronize - %p", this);
     auto absTp = VPU::getAbsoluteTimePoint(timeout);
 
+    pContext->flushPendingBatches();
+
     {
         std::shared_lock lock(fenceMutex);
         if (trackedJobs.empty() && fences.empty()) {
@@ -252,9 +303,26 @@ ze_result_t CommandQueue::synchronize(uint64_t timeout) {
     return result;
 }
 
+ze_result_t CommandQueue::waitForJobsInFlight(size_t maxInFlight, uint64_t timeout) {
+    if (trackedJobs.size() <= maxInFlight)
+        return ZE_RESULT_SUCCESS;
+
+    auto retiredEnd = trackedJobs.end() - static_cast<std::ptrdiff_t>(maxInFlight);
+    std::vector<std::shared_ptr<VPU::VPUJob>> retired(trackedJobs.begin(), retiredEnd);
+    ze_result_t result = waitForJobs(VPU::getAbsoluteTimePoint(timeout), retired);
+    if (result != ZE_RESULT_SUCCESS)
+        return result;
+
+    trackedJobs.erase(trackedJobs.begin(), retiredEnd);
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t CommandQueue::waitForJobs(std::chrono::steady_clock::time_point absTimePoint,
                                       const std::vector<std::shared_ptr<VPU::VPUJob>> &jobs) {
-    for (auto const &job : jobs) {
+    // Jobs complete in submission order within a kernel driver queue. Once the last job has
+    // reached its timeline value, the earlier jobs are completed by a read of the timeline fence.
+    for (auto it = jobs.rbegin(); it != jobs.rend(); it++) {
+        const auto &job = *it;
         if (!job->waitForCompletion(absTimePoint.time_since_epoch().count())) {
             return ZE_RESULT_NOT_READY;
         }
@@ -263,7 +331,16 @@ ze_result_t CommandQueue::waitForJobs(std::chrono::steady_clock::time_point absT
     return Device::jobStatusToResult(jobs);
 }
 
+void CommandQueue::enableAsyncSubmission() {
+    if (!submitWorker)
+        submitWorker = std::make_unique<VPU::VPUSubmissionWorker>(*vpuQueue);
+}
+
 ze_result_t CommandQueue::setWorkloadType(ze_command_queue_workload_type_t workloadType) {
+    // Jobs executed before the call are submitted with the previous priority
+    if (submitWorker)
+        submitWorker->drain();
+
     switch (workloadType) {
     case ZE_WORKLOAD_TYPE_DEFAULT:
         if (!vpuQueue->toDefaultPriority())
@@ -9,11 +9,14 @@
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "context.hpp"
 #include "fence.hpp" // IWYU pragma: keep
 #include "level_zero_driver/include/l0_handler.hpp"
 #include "vpu_driver/source/device/vpu_command_queue.hpp"
+#include "vpu_driver/source/device/vpu_submission_worker.hpp"
 
 #include <chrono> // IWYU pragma: keep
 #include <level_zero/ze_api.h>
@@ -21,6 +24,7 @@
 #include <memory>
 #include <shared_mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 struct _ze_command_queue_handle_t {};
@@ -29,6 +33,7 @@ class VPUJob;
 }
 
 namespace L0 {
+struct CommandList;
 struct Context;
 
 struct CommandQueue : _ze_command_queue_handle_t, IContextObject {
@@ -53,20 +58,45 @@ struct CommandQueue : _ze_command_queue_handle_t, IContextObject {
                                     ze_command_list_handle_t *phCommandLists,
                                     ze_fence_handle_t hFence);
     ze_result_t synchronize(uint64_t timeout);
+    /**
+     * Wait for the oldest jobs submitted without a fence until at most maxInFlight of them are
+     * left in flight. Jobs submitted with a fence are not waited for.
+     */
+    ze_result_t waitForJobsInFlight(size_t maxInFlight, uint64_t timeout);
 
     void destroyFence(Fence *pFence);
     ze_result_t waitForJobs(std::chrono::steady_clock::time_point timeout,
                             const std::vector<std::shared_ptr<VPU::VPUJob>> &jobs);
     ze_result_t setWorkloadType(ze_command_queue_workload_type_t workloadType);
+    bool isSynchronous() const { return queueMode == CommandQueueMode::SYNCHRONOUS; }
+
+    /**
+     * Submit jobs of command lists passed together to executeCommandLists as one fused job.
+     * Fused jobs are cached by the context for the recently executed groups of command lists.
+     */
+    void enableCommandListFusion() { fuseCommandLists = true; }
+
+    /**
+     * Move job submission to a dedicated thread, executeCommandLists returns right after
+     * the jobs are queued. Submission errors are reported by synchronize and fences.
+     */
+    void enableAsyncSubmission();
 
   protected:
+    std::shared_ptr<VPU::VPUJob> getFusedJob(const Context::FusedJobKey &key,
+                                             const std::vector<std::shared_ptr<VPU::VPUJob>> &jobs);
+
     std::unique_ptr<VPU::VPUDeviceQueue> vpuQueue;
+    // Declared after vpuQueue, worker has to finish before the queue is destroyed
+    std::unique_ptr<VPU::VPUSubmissionWorker> submitWorker;
     Context *pContext = nullptr;
 
     std::vector<std::shared_ptr<VPU::VPUJob>> trackedJobs;
     std::shared_mutex fenceMutex;
     std::unordered_map<Fence *, std::unique_ptr<Fence>> fences;
     CommandQueueMode queueMode;
+
+    bool fuseCommandLists = false;
 };
 
 } // namespace L0
@@ -5,12 +5,15 @@
  *
  */
 
+// IWYU pragma: no_include <bits/chrono.h>
+
 #include "context.hpp"
 
 #include "device.hpp"
 #include "driver.hpp"
 #include "driver_handle.hpp"
 #include "event.hpp"
+#include "immediate_cmdlist.hpp"
 #include "level_zero_driver/include/l0_exception.hpp"
 #include "level_zero_driver/source/ext/disk_cache.hpp"
 #include "metric.hpp"
@@ -19,10 +22,13 @@
 #include "vpu_driver/source/device/vpu_device.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
+#include <algorithm>
+#include <chrono> // IWYU pragma: keep
 #include <errno.h>
 #include <linux/sysinfo.h>
 #include <string.h>
 #include <sys/sysinfo.h>
+#include <vector>
 
 namespace L0 {
 
@@ -36,6 +42,104 @@ DriverHandle *Context::getDriverHandle() {
     return this->driverHandle;
 }
 
+std::shared_ptr<VPU::VPUJob> Context::takeFusedJob(const FusedJobKey &key) {
+    std::lock_guard<std::mutex> lock(fusedJobMutex);
+    auto it = std::find_if(fusedJobs.begin(), fusedJobs.end(), [&key](const auto &entry) {
+        return entry.key == key;
+    });
+    if (it == fusedJobs.end())
+        return nullptr;
+
+    auto job = std::move(it->job);
+    fusedJobs.erase(it);
+    return job;
+}
+
+void Context::putFusedJob(FusedJobKey key, std::shared_ptr<VPU::VPUJob> job) {
+    std::lock_guard<std::mutex> lock(fusedJobMutex);
+    if (fusedJobs.size() >= maxFusedJobs)
+        fusedJobs.erase(fusedJobs.begin());
+    fusedJobs.push_back({std::move(key), std::move(job)});
+}
+
+void Context::dropFusedJobs(const CommandList *cmdList) {
+    std::lock_guard<std::mutex> lock(fusedJobMutex);
+    auto holdsCmdList = [cmdList](const FusedJob &entry) {
+        return std::any_of(entry.key.begin(), entry.key.end(), [cmdList](const auto &item) {
+            return item.first == cmdList;
+        });
+    };
+    fusedJobs.erase(std::remove_if(fusedJobs.begin(), fusedJobs.end(), holdsCmdList),
+                    fusedJobs.end());
+}
+
+// Batch that is being appended to when its deadline passes is submitted after the delay
+static constexpr std::chrono::microseconds batchRetryDelay(50);
+
+Context::~Context() {
+    {
+        std::lock_guard<std::mutex> lock(batchMutex);
+        stopBatchFlusher = true;
+    }
+    batchCondition.notify_one();
+    if (batchFlusher.joinable())
+        batchFlusher.join();
+}
+
+void Context::addPendingBatch(ImmediateCommandList *cmdList,
+                              std::chrono::steady_clock::time_point deadline) {
+    std::lock_guard<std::mutex> lock(batchMutex);
+    if (!pendingBatches.emplace(cmdList, deadline).second)
+        return;
+
+    if (!batchFlusher.joinable())
+        batchFlusher = std::thread(&Context::runBatchFlusher, this);
+    batchCondition.notify_one();
+}
+
+void Context::removePendingBatch(ImmediateCommandList *cmdList) {
+    std::lock_guard<std::mutex> lock(batchMutex);
+    pendingBatches.erase(cmdList);
+}
+
+bool Context::hasPendingBatches() {
+    std::lock_guard<std::mutex> lock(batchMutex);
+    return !pendingBatches.empty();
+}
+
+void Context::flushPendingBatches() {
+    std::lock_guard<std::mutex> lock(batchMutex);
+    for (auto it = pendingBatches.begin(); it != pendingBatches.end();) {
+        // Command list that is appended to by another thread right now is left to the flusher
+        if (it->first->trySubmitBatch())
+            it = pendingBatches.erase(it);
+        else
+            ++it;
+    }
+}
+
+void Context::runBatchFlusher() {
+    std::unique_lock<std::mutex> lock(batchMutex);
+    while (!stopBatchFlusher) {
+        auto now = std::chrono::steady_clock::now();
+        auto wakeUp = std::chrono::steady_clock::time_point::max();
+        for (auto it = pendingBatches.begin(); it != pendingBatches.end();) {
+            if (it->second <= now && it->first->trySubmitBatch()) {
+                it = pendingBatches.erase(it);
+                continue;
+            }
+
+            wakeUp = std::min(wakeUp, std::max(it->second, now + batchRetryDelay));
+            ++it;
+        }
+
+        if (wakeUp == std::chrono::steady_clock::time_point::max())
+            batchCondition.wait(lock);
+        else
+            batchCondition.wait_until(lock, wakeUp);
+    }
+}
+
 ze_result_t Context::getStatus() {
     auto device = driverHandle->getPrimaryDevice();
     if (device == nullptr) {
@@ -185,7 +289,8 @@ ze_result_t Context::queryContextMemory(ze_graph_memory_query_type_t type,
         } else {
             query->total = info.totalram * info.mem_unit;
         }
-        query->allocated = ctx->getAllocatedSize();
+        // Released buffers kept for reuse are still held by the driver
+        query->allocated = ctx->getAllocatedSize() + ctx->getBufferCache().getCachedSize();
     } break;
     case ZE_GRAPH_QUERY_MEMORY_DRIVER_CACHE:
     case ZE_GRAPH_QUERY_MEMORY_PROGRAM_CACHE: {
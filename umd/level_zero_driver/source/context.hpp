@@ -7,6 +7,8 @@
 
 #pragma once
 
+// IWYU pragma: no_include <bits/chrono.h>
+
 #include <stddef.h>
 #include <stdint.h>
 
@@ -14,24 +16,34 @@
 #include "vpu_driver/source/device/vpu_device_context.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 
+#include <chrono> // IWYU pragma: keep
+#include <condition_variable>
 #include <level_zero/ze_api.h>
 #include <level_zero/ze_graph_ext.h>
 #include <level_zero/zet_api.h>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 struct _ze_context_handle_t {};
 
+namespace VPU {
+class VPUJob;
+} // namespace VPU
+
 namespace L0 {
+struct CommandList;
 struct DriverHandle;
+struct ImmediateCommandList;
 
 struct Context : _ze_context_handle_t {
     Context(DriverHandle *driverHandle, std::unique_ptr<VPU::VPUDeviceContext> ctx)
         : driverHandle(driverHandle)
         , ctx(std::move(ctx)){};
-    ~Context() = default;
+    ~Context();
 
     ze_result_t destroy();
     ze_result_t getStatus();
@@ -46,7 +58,8 @@ struct Context : _ze_context_handle_t {
                             size_t alignment,
                             void **ptr,
                             VPU::VPUBufferObject::Location location,
-                            VPU::VPUBufferObject::Type type);
+                            VPU::VPUBufferObject::Type type,
+                            bool prefault = false);
     ze_result_t importMemory(VPU::VPUBufferObject::Location type, int32_t fd, void **ptr);
     ze_result_t freeMem(void *ptr);
 
@@ -84,16 +97,60 @@ struct Context : _ze_context_handle_t {
     }
 
     void removeObject(IContextObject *obj) {
-        ctx->removeExpiredInternalBuffers();
         std::lock_guard<std::mutex> lock(mutex);
         objects.erase(obj);
     }
 
+    // Command lists and their versions, fused job is valid only for the same versions
+    using FusedJobKey = std::vector<std::pair<const CommandList *, uint64_t>>;
+
+    /**
+     * Fused jobs of recently executed groups of command lists, see CommandQueue::getFusedJob.
+     * Entry is dropped when any of its command lists is reset or destroyed.
+     * @return nullptr if no fused job is cached for the key, the entry is removed otherwise
+     */
+    std::shared_ptr<VPU::VPUJob> takeFusedJob(const FusedJobKey &key);
+    void putFusedJob(FusedJobKey key, std::shared_ptr<VPU::VPUJob> job);
+    void dropFusedJobs(const CommandList *cmdList);
+
+    /**
+     * Track immediate command list that holds appended commands which are not submitted yet.
+     * Pending batch is submitted by the context thread once the deadline passes, or earlier by
+     * a host synchronization.
+     */
+    void addPendingBatch(ImmediateCommandList *cmdList,
+                         std::chrono::steady_clock::time_point deadline);
+    void removePendingBatch(ImmediateCommandList *cmdList);
+    bool hasPendingBatches();
+
+    /**
+     * Submit all pending batches, a host wait might depend on any of them
+     */
+    void flushPendingBatches();
+
   private:
+    struct FusedJob {
+        FusedJobKey key;
+        std::shared_ptr<VPU::VPUJob> job;
+    };
+    static constexpr size_t maxFusedJobs = 8;
+
+    void runBatchFlusher();
+
     DriverHandle *driverHandle = nullptr;
     std::unique_ptr<VPU::VPUDeviceContext> ctx;
     std::unordered_map<void *, std::unique_ptr<IContextObject>> objects;
     std::mutex mutex;
+    // Least recently used first
+    std::vector<FusedJob> fusedJobs;
+    std::mutex fusedJobMutex;
+    std::unordered_map<ImmediateCommandList *, std::chrono::steady_clock::time_point>
+        pendingBatches;
+    std::mutex batchMutex;
+    std::condition_variable batchCondition;
+    bool stopBatchFlusher = false;
+    // Started by the first pending batch
+    std::thread batchFlusher;
 };
 
 } // namespace L0
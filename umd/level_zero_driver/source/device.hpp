@@ -12,6 +12,7 @@
 #include "vpu_driver/source/command/vpu_job.hpp"
 #include "vpu_driver/source/device/vpu_device.hpp"
 
+#include <errno.h>
 #include <functional>
 #include <level_zero/ze_api.h>
 #include <level_zero/zes_api.h>
@@ -79,6 +80,10 @@ struct Device : _ze_device_handle_t {
 
     static ze_result_t jobStatusToResult(const std::vector<std::shared_ptr<VPU::VPUJob>> &jobs) {
         for (const auto &job : jobs) {
+            // Failed asynchronous submission is reported as failed synchronous one
+            if (job->getSubmitError() == -EBADFD)
+                return ZE_RESULT_ERROR_DEVICE_LOST;
+
             auto jobStatus = job->getStatus();
             switch (jobStatus) {
             case DRM_IVPU_JOB_STATUS_SUCCESS:
@@ -17,10 +17,14 @@
 #include "vpu_driver/source/os_interface/vpu_device_factory.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 #include "vpu_driver/source/utilities/stats.hpp"
+#include "vpu_driver/source/utilities/thread_pool.hpp"
 
+#include <charconv>
 #include <memory>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -29,6 +33,18 @@ namespace L0 {
 static Driver driver;
 Driver *Driver::pDriver;
 
+static uint32_t getEnvUnsigned(const char *name, uint32_t defaultValue) {
+    const char *env = getenv(name);
+    if (env == nullptr)
+        return defaultValue;
+
+    uint32_t value = defaultValue;
+    std::string_view envStr = env;
+    // On error "from_chars" function leave "value" unmodified
+    std::from_chars(envStr.begin(), envStr.end(), value);
+    return value;
+}
+
 void Driver::initializeEnvVariables() {
     const char *env = getenv("ZE_AFFINITY_MASK");
     envVariables.affinityMask = env == nullptr ? "" : env;
@@ -43,6 +59,37 @@ void Driver::initializeEnvVariables() {
     env = getenv("ZE_SHARED_FORCE_DEVICE_ALLOC");
     envVariables.sharedForceDeviceAlloc =
         env == nullptr || env[0] == '0' || env[0] == '\0' ? false : true;
+
+    env = getenv("ZE_INTEL_NPU_ASYNC_SUBMIT");
+    envVariables.asyncSubmit = env == nullptr || env[0] == '0' || env[0] == '\0' ? false : true;
+
+    env = getenv("ZE_INTEL_NPU_FUSE_COMMAND_LISTS");
+    envVariables.fuseCommandLists =
+        env == nullptr || env[0] == '0' || env[0] == '\0' ? false : true;
+
+    envVariables.immediateInFlightMax = getEnvUnsigned("ZE_INTEL_NPU_IMMEDIATE_INFLIGHT_MAX", 1);
+    envVariables.immediateBatchSize = getEnvUnsigned("ZE_INTEL_NPU_IMMEDIATE_BATCH_SIZE", 1);
+    envVariables.immediateBatchWindowUs =
+        getEnvUnsigned("ZE_INTEL_NPU_IMMEDIATE_BATCH_WINDOW_US", 100);
+    envVariables.graphInstances = getEnvUnsigned("ZE_INTEL_NPU_GRAPH_INSTANCES", 1);
+
+    env = getenv("ZE_INTEL_NPU_SHARE_GRAPH_SECTIONS");
+    envVariables.shareGraphSections = env == nullptr || env[0] != '0';
+
+    envVariables.graphLoadThreads = getEnvUnsigned("ZE_INTEL_NPU_GRAPH_LOAD_THREADS", 4);
+    envVariables.graphCreateThreads = getEnvUnsigned("ZE_INTEL_NPU_GRAPH_CREATE_THREADS", 4);
+}
+
+Driver::~Driver() = default;
+
+VPU::ThreadPool &Driver::getGraphCreatePool() {
+    std::call_once(graphCreatePoolOnce, [this]() {
+        graphCreatePool = std::make_unique<VPU::ThreadPool>(envVariables.graphCreateThreads);
+        LOG(DRIVER,
+            "Graph creation pool started with %zu thread(s)",
+            graphCreatePool->getThreadCount());
+    });
+    return *graphCreatePool;
 }
 
 void Driver::initializeLogging() {
@@ -19,6 +19,7 @@
 
 namespace VPU {
 class OsInterface;
+class ThreadPool;
 } // namespace VPU
 
 namespace L0 {
@@ -30,13 +31,22 @@ class Driver {
         bool metrics;
         bool pciIdDeviceOrder;
         bool sharedForceDeviceAlloc;
+        bool asyncSubmit;
+        bool fuseCommandLists;
+        uint32_t immediateInFlightMax;
+        uint32_t immediateBatchSize;
+        uint32_t immediateBatchWindowUs;
+        uint32_t graphInstances;
+        bool shareGraphSections;
+        uint32_t graphLoadThreads;
+        uint32_t graphCreateThreads;
     };
 
     Driver() {
         initializeLogging();
         pDriver = this;
     }
-    virtual ~Driver() = default;
+    virtual ~Driver();
     void operator=(const Driver &) = delete;
 
     static Driver *getInstance() { return pDriver; }
@@ -47,6 +57,10 @@ class Driver {
     virtual DriverHandle *getDriverHandle() { return pGlobalDriverHandle.get(); }
 
     DiskCache &getDiskCache() { return *diskCache; }
+    /**
+     * Pool that runs asynchronous graph creation, started on the first use
+     */
+    VPU::ThreadPool &getGraphCreatePool();
 
     std::unique_ptr<DiskCache> diskCache;
 
@@ -63,6 +77,9 @@ class Driver {
     VPU::OsInterface *osInfc = nullptr;
     ze_result_t initStatus = ZE_RESULT_ERROR_UNINITIALIZED;
     std::once_flag initDriverOnce;
+    // Destroyed first, queued graph creations still use the devices and the disk cache
+    std::unique_ptr<VPU::ThreadPool> graphCreatePool;
+    std::once_flag graphCreatePoolOnce;
 };
 
 ze_result_t init(ze_init_flags_t);
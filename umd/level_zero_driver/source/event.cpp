@@ -9,18 +9,22 @@
 
 #include "event.hpp"
 
+#include "context.hpp"
+#include "device.hpp"
 #include "metric.hpp"
 #include "metric_streamer.hpp"
 #include "vpu_driver/source/command/vpu_command_buffer.hpp"
 #include "vpu_driver/source/command/vpu_job.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
+#include "vpu_driver/source/utilities/spin_wait.hpp"
 #include "vpu_driver/source/utilities/timer.hpp"
 
 #include <algorithm>
 #include <chrono> // IWYU pragma: keep
 #include <level_zero/ze_api.h>
 #include <thread>
+#include <uapi/drm/ivpu_accel.h>
 
 namespace VPU {
 class VPUBufferObject;
@@ -28,12 +32,13 @@ class VPUBufferObject;
 
 namespace L0 {
 
-Event::Event(VPU::VPUDeviceContext *ctx,
+Event::Event(Context *pContext,
              VPU::VPUEventCommand::KMDEventDataType *ptr,
              const std::shared_ptr<VPU::VPUBufferObject> eventBaseBo,
              uint64_t vpuAddr,
              std::function<void()> &&destroyCb)
-    : pDevCtx(ctx)
+    : pContext(pContext)
+    , pDevCtx(pContext->getDeviceContext())
     , eventState(ptr)
     , eventBase(std::move(eventBaseBo))
     , eventVpuAddr(vpuAddr)
@@ -78,9 +83,27 @@ void Event::trackMetricData(int64_t timeoutNs) {
     } while (std::chrono::steady_clock::now() < timeOut);
 }
 
+// Event memory is polled with growing sleep once the spin time has passed, command buffers
+// signaling the event are probed for failure at most once per interval
+static constexpr std::chrono::microseconds minPollSleep(10);
+static constexpr std::chrono::microseconds maxPollSleep(500);
+static constexpr std::chrono::milliseconds jobProbeInterval(1);
+
+static bool isSignaledState(uint64_t state) {
+    return state == VPU::VPUEventCommand::STATE_DEVICE_SIGNAL ||
+           state == VPU::VPUEventCommand::STATE_HOST_SIGNAL;
+}
+
+bool Event::isSignaled() const {
+    return isSignaledState(*eventState);
+}
+
 ze_result_t Event::hostSynchronize(uint64_t timeout) {
     auto absoluteTimeout = VPU::getAbsoluteTimeoutNanoseconds(timeout);
 
+    // Event might be signaled by commands of an immediate batch that is not submitted yet
+    pContext->flushPendingBatches();
+
     /* Remove dangling weak pointers */
     associatedJobs.erase(std::remove_if(associatedJobs.begin(),
                                         associatedJobs.end(),
@@ -89,23 +112,77 @@ ze_result_t Event::hostSynchronize(uint64_t timeout) {
 
     LOG(EVENT, "Waiting for fence in VPUAddr: %#lx", eventVpuAddr);
 
-    for (auto &jobWeak : associatedJobs) {
-        if (auto job = jobWeak.lock()) {
-            for (const auto &cmdBuffer : job->getCommandBuffers()) {
-                if (cmdBuffer->getFenceAddr() == eventVpuAddr) {
-                    // TODO: Add check for ABORTED status from command buffer completion
-                    if (!cmdBuffer->waitForCompletion(absoluteTimeout)) {
-                        LOG_E("Associated command buffer is still in execution!");
-                    }
-                }
+    /*
+     * Fence signal is inline in the command buffer, so the event state is polled in memory until
+     * the event is signaled or the timeout passes. Command buffers that carry the fence are only
+     * probed for failure, the device does not signal the fence of an aborted job.
+     */
+    if (VPU::SpinWait::spinUntil(eventState, isSignaledState, absoluteTimeout))
+        return queryStatus(absoluteTimeout);
+
+    // Returns ZE_RESULT_NOT_READY while the job might still signal the fence
+    auto probeJob = [this](const std::shared_ptr<VPU::VPUJob> &job) {
+        if (!job->waitForSubmit(0))
+            return ZE_RESULT_NOT_READY;
+
+        if (job->isSubmitFailed())
+            return Device::jobStatusToResult({job});
+
+        for (const auto &cmdBuffer : job->getCommandBuffers()) {
+            if (!cmdBuffer->hasFenceAddr(eventVpuAddr))
+                continue;
+
+            if (!cmdBuffer->waitForCompletion(0))
+                return ZE_RESULT_NOT_READY;
+
+            if (!cmdBuffer->isSuccess()) {
+                LOG_E("Command buffer signaling the event failed with status %#lx",
+                      cmdBuffer->getResult());
+                return cmdBuffer->getResult() == DRM_IVPU_JOB_STATUS_ABORTED
+                           ? ZE_RESULT_ERROR_DEVICE_LOST
+                           : ZE_RESULT_ERROR_UNKNOWN;
+            }
+        }
+        return ZE_RESULT_SUCCESS;
+    };
+
+    auto pollSleep = minPollSleep;
+    auto nextProbe = std::chrono::steady_clock::now();
+    while (!isSignaled()) {
+        auto now = std::chrono::steady_clock::now();
+        int64_t leftNs = absoluteTimeout - now.time_since_epoch().count();
+        if (leftNs <= 0)
+            break;
+
+        if (now >= nextProbe) {
+            nextProbe = now + jobProbeInterval;
+            for (auto &jobWeak : associatedJobs) {
+                auto job = jobWeak.lock();
+                if (job == nullptr)
+                    continue;
+
+                // Commands of the job might be submitted as a part of fused job
+                if (auto fusedJob = job->getFusedJob())
+                    job = std::move(fusedJob);
+
+                ze_result_t result = probeJob(job);
+                // Event might have been signaled right before the job completed
+                if (result != ZE_RESULT_NOT_READY && result != ZE_RESULT_SUCCESS && !isSignaled())
+                    return result;
             }
         }
+
+        std::this_thread::sleep_for(
+            std::min<std::chrono::nanoseconds>(pollSleep, std::chrono::nanoseconds(leftNs)));
+        pollSleep = std::min(pollSleep * 2, maxPollSleep);
     }
 
     return queryStatus(absoluteTimeout);
 }
 
 ze_result_t Event::queryStatus(int64_t timeout) {
+    pContext->flushPendingBatches();
+
     if (msExpectedDataSize && *eventState < VPU::VPUEventCommand::STATE_DEVICE_SIGNAL)
         trackMetricData(timeout);
 
@@ -28,10 +28,11 @@ class VPUJob;
 struct _ze_event_handle_t {};
 
 namespace L0 {
+struct Context;
 
 struct Event : _ze_event_handle_t, IContextObject {
   public:
-    Event(VPU::VPUDeviceContext *ctx,
+    Event(Context *pContext,
           VPU::VPUEventCommand::KMDEventDataType *ptr,
           const std::shared_ptr<VPU::VPUBufferObject> eventBaseBo,
           uint64_t vpuAddr,
@@ -58,8 +59,10 @@ struct Event : _ze_event_handle_t, IContextObject {
     void trackMetricData(int64_t timeoutNs);
 
   private:
+    bool isSignaled() const;
     void setEventState(VPU::VPUEventCommand::KMDEventDataType updateTo);
 
+    Context *pContext = nullptr;
     VPU::VPUDeviceContext *pDevCtx = nullptr;
     VPU::VPUEventCommand::KMDEventDataType *eventState = nullptr;
     const std::shared_ptr<VPU::VPUBufferObject> eventBase;
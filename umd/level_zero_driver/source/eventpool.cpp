@@ -13,6 +13,7 @@
 #include "vpu_driver/source/command/vpu_event_command.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/memory/vpu_slab_allocator.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
 #include <level_zero/ze_api.h>
@@ -76,13 +77,17 @@ EventPool::EventPool(Context *pContext, const ze_event_pool_desc_t *desc)
     , pEventPool(nullptr)
     , events(desc->count) {
     pEventPool =
-        ctx->createUntrackedBufferObject(sizeof(VPU::VPUEventCommand::JsmEventData) * events.size(),
-                                         VPU::VPUBufferObject::Type::CachedFw);
+        ctx->createUntrackedBufferChunk(sizeof(VPU::VPUEventCommand::JsmEventData) * events.size(),
+                                        VPU::VPUBufferObject::Type::CachedFw);
     L0_THROW_WHEN(pEventPool == nullptr,
                   "Failed to allocate buffer object for event pool",
                   ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY);
 }
 
+std::shared_ptr<VPU::VPUBufferObject> EventPool::getEventBase() {
+    return pEventPool->getBufferObject();
+}
+
 VPU::VPUEventCommand::KMDEventDataType *EventPool::getEventCpuAddress(uint32_t index) {
     auto eventPtr =
         reinterpret_cast<VPU::VPUEventCommand::JsmEventData *>(pEventPool->getBasePointer());
@@ -117,7 +122,7 @@ ze_result_t EventPool::createEvent(const ze_event_desc_t *desc, ze_event_handle_
                       ZE_RESULT_ERROR_UNKNOWN);
 
         events[index] =
-            std::make_unique<Event>(ctx, eventPtr, getEventBase(), vpuAddr, [this, index]() {
+            std::make_unique<Event>(pContext, eventPtr, getEventBase(), vpuAddr, [this, index]() {
                 events[index].reset();
             });
         *phEvent = events[index].get();
@@ -21,6 +21,7 @@ namespace L0 {
 struct Context;
 } // namespace L0
 namespace VPU {
+class VPUBufferChunk;
 class VPUBufferObject;
 class VPUDeviceContext;
 } // namespace VPU
@@ -47,13 +48,13 @@ struct EventPool : _ze_event_pool_handle_t, IContextObject {
     ze_result_t createEvent(const ze_event_desc_t *desc, ze_event_handle_t *phEvent);
 
     VPU::VPUEventCommand::KMDEventDataType *getEventCpuAddress(uint32_t index);
-    const std::shared_ptr<VPU::VPUBufferObject> &getEventBase() { return pEventPool; }
+    std::shared_ptr<VPU::VPUBufferObject> getEventBase();
     bool freeEvent(uint32_t index);
 
   private:
     Context *pContext = nullptr;
     VPU::VPUDeviceContext *ctx = nullptr;
-    std::shared_ptr<VPU::VPUBufferObject> pEventPool = nullptr;
+    std::shared_ptr<VPU::VPUBufferChunk> pEventPool = nullptr;
     std::vector<std::unique_ptr<Event>> events;
 };
 
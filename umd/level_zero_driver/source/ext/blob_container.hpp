@@ -23,6 +23,12 @@ class BlobContainer {
         , size(size) {}
     virtual ~BlobContainer() = default;
 
+    /**
+     * File the blob is mapped from, nullptr if the blob is in memory. Reading the file instead of
+     * the mapping does not fault the pages of the blob into the process.
+     */
+    virtual VPU::OsFile *getFile() const { return nullptr; }
+
   public:
     uint8_t *ptr;
     size_t size;
@@ -34,6 +40,8 @@ class BlobFileContainer : public BlobContainer {
         : BlobContainer(ptr, size)
         , file(std::move(file)) {}
 
+    VPU::OsFile *getFile() const override { return file.get(); }
+
   private:
     std::unique_ptr<VPU::OsFile> file;
 };
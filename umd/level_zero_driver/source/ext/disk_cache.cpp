@@ -16,6 +16,8 @@
 #include "vpu_driver/source/os_interface/os_interface.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
+#include <algorithm>
+#include <array>
 #include <charconv>
 #include <filesystem>
 #include <functional>
@@ -29,6 +31,7 @@
 #include <sys/stat.h>
 #include <time.h>
 #include <utility>
+#include <vector>
 
 namespace L0 {
 
@@ -116,14 +119,26 @@ DiskCache::Key DiskCache::computeKey(const ze_graph_desc_2_t &desc) {
 }
 
 static bool validBlobChecksum(VPU::OsFile &file) {
-    uint8_t *filePtr = static_cast<uint8_t *>(file.mmap());
-    if (filePtr == nullptr)
+    if (file.size() <= HashSha1::DigestLength)
         return false;
 
-    uint64_t offsetSum = file.size() - HashSha1::DigestLength;
-    HashSha1::DigestType fileSum = reinterpret_cast<HashSha1::DigestType>(filePtr + offsetSum);
-    std::string computedSum = HashSha1::getDigest(filePtr, offsetSum);
-    return computedSum == std::string_view(fileSum, HashSha1::DigestLength);
+    // Checksum is computed while the file is read in chunks, the blob pages stay in the page
+    // cache and are not faulted into the process through the mapping
+    constexpr size_t chunkSize = 1024 * 1024;
+    size_t offsetSum = file.size() - HashSha1::DigestLength;
+    std::vector<uint8_t> chunk(std::min(chunkSize, offsetSum));
+    HashSha1 hash;
+    for (size_t offset = 0; offset < offsetSum; offset += chunk.size()) {
+        size_t size = std::min(chunk.size(), offsetSum - offset);
+        if (!file.read(chunk.data(), size, offset))
+            return false;
+        hash.update(chunk.data(), size);
+    }
+
+    std::array<char, HashSha1::DigestLength> fileSum;
+    if (!file.read(fileSum.data(), fileSum.size(), offsetSum))
+        return false;
+    return hash.final() == std::string_view(fileSum.data(), fileSum.size());
 }
 
 std::unique_ptr<BlobContainer> DiskCache::getBlob(const Key &key) {
@@ -152,6 +167,15 @@ std::unique_ptr<BlobContainer> DiskCache::getBlob(const Key &key) {
                                                std::move(file));
 }
 
+void DiskCache::removeBlob(const Key &key) {
+    if (cachePath.empty() || key.empty())
+        return;
+
+    LOG(CACHE, "Removing %s key: Cached blob failed to parse", key.c_str());
+    /* Remove the file without setting exclusive lock comparing to "setBlob()" function */
+    osInfc.osiFileRemove(cachePath / key);
+}
+
 static size_t
 removeLeastUsedFiles(VPU::OsInterface &osInfc, std::filesystem::path &cachePath, size_t expSize) {
     std::map<time_t, std::string> sortedFiles;
@@ -13,6 +13,7 @@
 #include "level_zero/ze_api.h"
 #include "level_zero/ze_graph_ext.h"
 #include "level_zero_driver/include/l0_exception.hpp"
+#include "level_zero_driver/source/driver.hpp"
 #include "profiling_data.hpp"
 #include "umd_common.hpp"
 #include "vpu_driver/source/command/vpu_inference_execute.hpp"
@@ -22,6 +23,8 @@
 #include "vpu_driver/source/device/vpu_device_context.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
+#include "vpu_driver/source/utilities/sha256.hpp"
+#include "vpu_driver/source/utilities/thread_pool.hpp"
 #include "vpux_elf/types/data_types.hpp"
 #include "vpux_elf/types/section_header.hpp"
 #include "vpux_headers/buffer_specs.hpp"
@@ -33,13 +36,19 @@
 #include <algorithm>
 #include <array>
 #include <bitset>
+#include <chrono>
 #include <exception>
 #include <functional>
 #include <iterator>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string.h>
+#include <string>
+#include <utility>
+#include <vector>
 #include <vpux_elf/accessor.hpp>
+#include <vpux_elf/reader.hpp>
 #include <vpux_elf/types/vpu_extensions.hpp>
 #include <vpux_elf/utils/error.hpp>
 #include <vpux_elf/utils/utils.hpp>
@@ -92,25 +101,47 @@ class DriverBufferManager : public elf::BufferManager {
 
         void *ptr = bo->getBasePointer();
         const std::lock_guard<std::mutex> lock(mtx);
-        auto [it, success] = tracedElfParserBuffers.emplace(ptr, std::move(bo));
+        auto [it, success] = tracedElfParserBuffers.emplace(ptr, TracedBuffer{std::move(bo), 1});
         if (!success) {
             LOG_E("Failed to trace elf parser buffer");
             return elf::DeviceBuffer();
         }
-        return elf::DeviceBuffer(it->second->getBasePointer(),
-                                 it->second->getVPUAddr(),
+        return elf::DeviceBuffer(it->second.bo->getBasePointer(),
+                                 it->second.bo->getVPUAddr(),
                                  buffSpecs.size);
     }
 
+    /**
+     * Track buffer object shared with other graphs, every copy of the section is tracked by
+     * a reference. Buffer is released by deallocate of the last reference.
+     */
+    elf::DeviceBuffer trackShared(std::shared_ptr<VPU::VPUBufferObject> bo, size_t size) {
+        void *ptr = bo->getBasePointer();
+        const std::lock_guard<std::mutex> lock(mtx);
+        auto [it, _] = tracedElfParserBuffers.try_emplace(ptr, TracedBuffer{std::move(bo), 0});
+        it->second.refs++;
+        return elf::DeviceBuffer(it->second.bo->getBasePointer(),
+                                 it->second.bo->getVPUAddr(),
+                                 size);
+    }
+
     void deallocate(elf::DeviceBuffer &devAddress) override {
         LOG(GRAPH,
             "Deallocate: cpu: %p, vpu: %#lx, size: %lu",
             devAddress.cpu_addr(),
             devAddress.vpu_addr(),
             devAddress.size());
+        if (devAddress.cpu_addr() == nullptr)
+            return;
+
         const std::lock_guard<std::mutex> lock(mtx);
-        if (devAddress.cpu_addr() && tracedElfParserBuffers.erase(devAddress.cpu_addr()) == 0)
+        auto it = tracedElfParserBuffers.find(devAddress.cpu_addr());
+        if (it == tracedElfParserBuffers.end()) {
             LOG_E("Failed to deallocate elf parser memory");
+            return;
+        }
+        if (--it->second.refs == 0)
+            tracedElfParserBuffers.erase(it);
     }
 
     void lock(elf::DeviceBuffer &devAddress) override {}
@@ -149,22 +180,171 @@ class DriverBufferManager : public elf::BufferManager {
         if (it == tracedElfParserBuffers.end()) {
             return nullptr;
         }
-        return it->second;
+        return it->second.bo;
     }
 
   private:
+    struct TracedBuffer {
+        std::shared_ptr<VPU::VPUBufferObject> bo;
+        uint32_t refs;
+    };
+
     mutable std::mutex mtx;
     VPU::VPUDeviceContext *ctx;
-    std::map<const void *, std::shared_ptr<VPU::VPUBufferObject>, std::greater<const void *>>
-        tracedElfParserBuffers;
+    std::map<const void *, TracedBuffer, std::greater<const void *>> tracedElfParserBuffers;
 };
 
+/**
+ * Hands out the buffer object of a read only section shared with other graphs. Every allocation
+ * of the section, e.g. by a copy of elf::HostParsedInference, gets the same buffer object.
+ * Content of the section is kept in host memory by the blob, the write combined buffer object is
+ * never read back.
+ */
+class SharedSectionBufferManager : public elf::BufferManager {
+  public:
+    SharedSectionBufferManager(DriverBufferManager *manager,
+                               std::shared_ptr<VPU::VPUBufferObject> bo,
+                               const elf::BufferSpecs &specs,
+                               const uint8_t *content)
+        : manager(manager)
+        , bo(std::move(bo))
+        , specs(specs)
+        , content(content) {}
+    ~SharedSectionBufferManager() override = default;
+
+    elf::DeviceBuffer allocate(const elf::BufferSpecs &buffSpecs) override {
+        return manager->trackShared(bo, buffSpecs.size);
+    }
+
+    void deallocate(elf::DeviceBuffer &devAddress) override { manager->deallocate(devAddress); }
+
+    void lock(elf::DeviceBuffer &devAddress) override {}
+    void unlock(elf::DeviceBuffer &devAddress) override {}
+
+    size_t copy(elf::DeviceBuffer &to, const uint8_t *from, size_t count) override {
+        // Content is uploaded once, other graphs may already execute from the buffer
+        if (to.cpu_addr() == from || from == content ||
+            (count <= specs.size && memcmp(content, from, count) == 0))
+            return count;
+
+        // Different content goes to a private buffer of the section
+        LOG_W("Shared section content differs, cpu_addr: %p, using private buffer", to.cpu_addr());
+        elf::DeviceBuffer buffer = manager->allocate(specs);
+        if (buffer.cpu_addr() == nullptr)
+            return 0;
+        if (count < buffer.size())
+            manager->copy(buffer, content, buffer.size());
+        manager->deallocate(to);
+        to = buffer;
+        return manager->copy(to, from, count);
+    }
+
+  private:
+    DriverBufferManager *manager;
+    std::shared_ptr<VPU::VPUBufferObject> bo;
+    elf::BufferSpecs specs;
+    const uint8_t *content;
+};
+
+/**
+ * Hands out the buffer object of a section uploaded in advance by ElfAccessManager::preload. Only
+ * the first allocation gets the uploaded buffer, copies of the section get new buffers.
+ */
+class PreparedSectionBufferManager : public elf::BufferManager {
+  public:
+    PreparedSectionBufferManager(DriverBufferManager *manager,
+                                 std::shared_ptr<VPU::VPUBufferObject> bo)
+        : manager(manager)
+        , bo(std::move(bo)) {}
+    ~PreparedSectionBufferManager() override = default;
+
+    elf::DeviceBuffer allocate(const elf::BufferSpecs &buffSpecs) override {
+        const std::lock_guard<std::mutex> lock(mtx);
+        if (bo == nullptr)
+            return manager->allocate(buffSpecs);
+        return manager->trackShared(std::move(bo), buffSpecs.size);
+    }
+
+    void deallocate(elf::DeviceBuffer &devAddress) override { manager->deallocate(devAddress); }
+
+    void lock(elf::DeviceBuffer &devAddress) override {}
+    void unlock(elf::DeviceBuffer &devAddress) override {}
+
+    size_t copy(elf::DeviceBuffer &to, const uint8_t *from, size_t count) override {
+        return manager->copy(to, from, count);
+    }
+
+  private:
+    DriverBufferManager *manager;
+    std::mutex mtx;
+    std::shared_ptr<VPU::VPUBufferObject> bo;
+};
+
+static bool isInBlob(const elf::SectionHeader &sh, size_t size) {
+    return sh.sh_type != elf::SHT_NOBITS && sh.sh_offset <= size &&
+           sh.sh_size <= size - sh.sh_offset;
+}
+
+/**
+ * Returns file offsets and sizes of sections that can be shared between graphs. Section is
+ * shared if it is not writable, not a target of any relocation, and large enough to be worth
+ * a separate buffer object.
+ */
+static std::map<size_t, size_t>
+findShareableSections(const std::vector<elf::SectionHeader> &headers, size_t size) {
+    // Smaller sections share pages with the allocation granularity anyway
+    constexpr size_t minSharedSectionSize = 64 * 1024;
+
+    // Processor and user specific section types may be relocations too, their targets are
+    // treated as relocated
+    std::vector<bool> relocated(headers.size(), false);
+    for (const auto &sh : headers) {
+        bool isRelocation = sh.sh_type == elf::SHT_REL || sh.sh_type == elf::SHT_RELA ||
+                            (sh.sh_flags & elf::SHF_INFO_LINK) || sh.sh_type >= elf::SHT_LOPROC;
+        if (isRelocation && sh.sh_info < relocated.size())
+            relocated[sh.sh_info] = true;
+    }
+
+    std::map<size_t, size_t> sections;
+    for (size_t i = 0; i < headers.size(); i++) {
+        const auto &sh = headers[i];
+        if (relocated[i] || (sh.sh_flags & elf::SHF_WRITE) || sh.sh_size < minSharedSectionSize ||
+            !isInBlob(sh, size))
+            continue;
+        sections.emplace(sh.sh_offset, sh.sh_size);
+    }
+    return sections;
+}
+
 class ElfAccessManager : public elf::AccessManager {
   public:
-    ElfAccessManager(uint8_t *ptr, size_t size, DriverBufferManager *manager)
-        : AccessManager(size)
-        , blob(ptr)
-        , bufferManager(manager) {}
+    struct LoadStats {
+        size_t sections = 0;
+        size_t copySize = 0;
+        size_t threads = 0;
+        uint64_t allocUs = 0;
+        uint64_t copyUs = 0;
+        std::chrono::steady_clock::time_point preloadStart;
+        std::chrono::steady_clock::time_point preloadEnd;
+    };
+
+    ElfAccessManager(const BlobContainer &container,
+                     DriverBufferManager *manager,
+                     VPU::VPUDeviceContext *ctx,
+                     bool shareSections,
+                     uint32_t loadThreads,
+                     VPU::ThreadPool *loadPool)
+        : AccessManager(container.size)
+        , blob(container.ptr)
+        , file(container.getFile())
+        , bufferManager(manager)
+        , ctx(ctx)
+        , loadThreads(loadThreads)
+        , loadPool(loadPool) {
+        sectionHeaders = readSectionHeaders();
+        if (shareSections)
+            shareableSections = findShareableSections(sectionHeaders, container.size);
+    }
 
     ElfAccessManager(const ElfAccessManager &) = delete;
     ElfAccessManager(ElfAccessManager &&) = delete;
@@ -181,15 +361,30 @@ class ElfAccessManager : public elf::AccessManager {
         uint8_t *start = blob + offset;
 
         if (hasNPUAccess(specs.procFlags)) {
-            auto buffer = std::make_unique<elf::AllocatedDeviceBuffer>(bufferManager, specs);
+            std::call_once(preloadOnce, [this] {
+                auto preloadStart = std::chrono::steady_clock::now();
+                preload();
+                const std::lock_guard<std::mutex> lock(sectionsMtx);
+                loadStats.preloadStart = preloadStart;
+                loadStats.preloadEnd = std::chrono::steady_clock::now();
+            });
+
+            auto buffer = readPrepared(offset, specs);
+            if (buffer != nullptr)
+                return buffer;
+
+            buffer = std::make_unique<elf::AllocatedDeviceBuffer>(bufferManager, specs);
             elf::DeviceBuffer devBuffer = buffer->getBuffer();
-            bufferManager->copy(devBuffer, start, devBuffer.size());
+            auto bo = bufferManager->findBuffer(devBuffer.cpu_addr());
+            if (file == nullptr || bo == nullptr ||
+                !readToBuffer(*bo, 0, offset, devBuffer.size()))
+                bufferManager->copy(devBuffer, start, devBuffer.size());
             return buffer;
         }
 
         auto dynBuffer = std::make_unique<elf::DynamicBuffer>(specs);
         elf::DeviceBuffer devBuffer = dynBuffer->getBuffer();
-        memcpy(devBuffer.cpu_addr(), start, devBuffer.size());
+        read(devBuffer.cpu_addr(), devBuffer.size(), offset);
 
         return dynBuffer;
     }
@@ -200,17 +395,273 @@ class ElfAccessManager : public elf::AccessManager {
                             "Read request out of bounds");
 
         elf::DeviceBuffer devBuffer = buffer.getBuffer();
-        memcpy(devBuffer.cpu_addr(), blob + offset, devBuffer.size());
+        read(devBuffer.cpu_addr(), devBuffer.size(), offset);
+    }
+
+    LoadStats getLoadStats() {
+        const std::lock_guard<std::mutex> lock(sectionsMtx);
+        return loadStats;
+    }
+
+    /**
+     * Release sections uploaded by preload that the loader did not take
+     */
+    void releasePrepared() {
+        const std::lock_guard<std::mutex> lock(sectionsMtx);
+        prepared.clear();
     }
 
   private:
+    struct PreparedSection {
+        size_t size;
+        uint64_t flags;
+        bool shared;
+        std::shared_ptr<VPU::VPUBufferObject> bo;
+    };
+
+    struct Upload {
+        size_t offset;
+        size_t size;
+        uint64_t flags;
+        bool shared;
+        std::shared_ptr<VPU::VPUBufferObject> bo;
+        // Hashes of the hashChunkSize parts of a shared section, filled in by the copies
+        std::vector<VPU::HashSha256::Digest> chunkHashes;
+    };
+
     static bool hasNPUAccess(uint64_t flags) {
         return (flags & (elf::SHF_EXECINSTR | elf::VPU_SHF_PROC_DMA | elf::VPU_SHF_PROC_SHAVE |
                          elf::SHF_ALLOC)) != 0;
     }
 
+    /**
+     * Returns section headers of the blob, or no headers if the blob is not a valid ELF file.
+     * Headers are read through this access manager, section contents are not read.
+     */
+    std::vector<elf::SectionHeader> readSectionHeaders() {
+        std::vector<elf::SectionHeader> headers;
+        try {
+            elf::Reader<elf::ELF_Bitness::Elf64> reader(this);
+            headers.reserve(reader.getSectionsNum());
+            for (size_t i = 0; i < reader.getSectionsNum(); i++)
+                headers.push_back(*reader.getSectionNoData(i).getHeader());
+        } catch (const std::exception &err) {
+            LOG_W("Failed to read section headers, reason: %s", err.what());
+            headers.clear();
+        }
+        return headers;
+    }
+
+    /**
+     * Copy part of the blob to host memory, file backed blob is read from the file
+     */
+    void read(uint8_t *dst, size_t size, size_t offset) {
+        if (size == 0 || (file != nullptr && file->read(dst, size, offset)))
+            return;
+        memcpy(dst, blob + offset, size);
+    }
+
+    /**
+     * Copy part of the blob to buffer object. File backed blob is read straight into the buffer
+     * mapping, so the blob is not mapped into the process in addition to the buffer.
+     */
+    bool readToBuffer(VPU::VPUBufferObject &bo, size_t boOffset, size_t offset, size_t size) {
+        uint8_t *dst = bo.getBasePointer();
+        if (file != nullptr && dst != nullptr && boOffset + size <= bo.getAllocSize() &&
+            file->read(dst + boOffset, size, offset))
+            return true;
+        return bo.copyToBuffer(blob + offset, size, boOffset);
+    }
+
+    /**
+     * Hash part of shared section, part starts at a multiple of hashChunkSize in the section
+     */
+    static void hashPart(Upload &upload, size_t partOffset, const uint8_t *data, size_t size) {
+        constexpr size_t chunkSize = VPU::VPUSharedBuffers::hashChunkSize;
+        for (size_t pos = 0; pos < size; pos += chunkSize)
+            upload.chunkHashes[(partOffset + pos) / chunkSize] =
+                VPU::VPUSharedBuffers::hashChunk(data + pos, std::min(chunkSize, size - pos));
+    }
+
+    /**
+     * Copy part of section to its buffer object. Shared section is hashed on the way from host
+     * memory, the buffer object mapping may be write combined.
+     */
+    bool uploadPart(Upload &upload, size_t partOffset, size_t size) {
+        size_t offset = upload.offset + partOffset;
+        if (!upload.shared)
+            return readToBuffer(*upload.bo, partOffset, offset, size);
+
+        const uint8_t *data = blob + offset;
+        std::vector<uint8_t> part;
+        if (file != nullptr) {
+            part.resize(size);
+            read(part.data(), size, offset);
+            data = part.data();
+        }
+        hashPart(upload, partOffset, data, size);
+        return upload.bo->copyToBuffer(data, size, partOffset);
+    }
+
+    /**
+     * Run task for every index below count on up to loadThreads threads of the load pool
+     */
+    void runParallel(size_t count, const std::function<void(size_t)> &task) {
+        if (loadPool == nullptr) {
+            for (size_t i = 0; i < count; i++)
+                task(i);
+            return;
+        }
+        loadPool->runParallel(count, loadThreads, task);
+    }
+
+    bool isShareable(size_t offset, size_t size) const {
+        auto it = shareableSections.find(offset);
+        return it != shareableSections.end() && it->second == size;
+    }
+
+    /**
+     * Publish uploaded section in VPUSharedBuffers, or take the buffer object of the same content
+     * published by another graph. Content is matched by its SHA-256 digest, write combined buffer
+     * objects are not read back.
+     */
+    void share(Upload &upload) {
+        auto type = bufferManager->getBufferType(upload.flags);
+        VPU::VPUSharedBuffers::Key key = {
+            VPU::VPUSharedBuffers::combineHashes(upload.chunkHashes),
+            upload.size,
+            static_cast<uint64_t>(type)};
+        upload.bo = ctx->getSharedBuffers().add(key, upload.bo);
+    }
+
+    /**
+     * Upload all sections with NPU access before the loader reads them. Buffer objects are
+     * allocated on loadThreads threads first, then the sections are copied in chunks on
+     * loadThreads threads, so a large section is copied by all the threads. Keys of shared
+     * sections are hashed per chunk by the thread that copies it. Function returns when all
+     * copies are completed, the loader applies relocations to the uploaded sections afterwards.
+     */
+    void preload() {
+        std::vector<Upload> uploads;
+        for (const auto &sh : sectionHeaders) {
+            if (sh.sh_size == 0 || !hasNPUAccess(sh.sh_flags) || !isInBlob(sh, getSize()))
+                continue;
+            bool shared = isShareable(sh.sh_offset, sh.sh_size);
+            uploads.push_back({sh.sh_offset, sh.sh_size, sh.sh_flags, shared, nullptr, {}});
+        }
+        if (uploads.empty())
+            return;
+
+        // Largest sections first to balance the allocations between the threads
+        std::sort(uploads.begin(), uploads.end(), [](const Upload &a, const Upload &b) {
+            return a.size > b.size;
+        });
+
+        constexpr size_t hashChunkSize = VPU::VPUSharedBuffers::hashChunkSize;
+        auto allocStart = std::chrono::steady_clock::now();
+        runParallel(uploads.size(), [&](size_t i) {
+            auto &upload = uploads[i];
+            auto type = bufferManager->getBufferType(upload.flags);
+            upload.bo = ctx->createUntrackedBufferObject(upload.size, type);
+            if (upload.shared && upload.bo != nullptr)
+                upload.chunkHashes.resize((upload.size + hashChunkSize - 1) / hashChunkSize);
+        });
+
+        auto copyStart = std::chrono::steady_clock::now();
+        // Chunks start at hash chunks of the section
+        constexpr size_t chunkSize = 4 * hashChunkSize;
+        std::vector<std::pair<size_t, size_t>> chunks;
+        for (size_t i = 0; i < uploads.size(); i++) {
+            for (size_t offset = 0; uploads[i].bo != nullptr && offset < uploads[i].size;
+                 offset += chunkSize)
+                chunks.emplace_back(i, offset);
+        }
+
+        std::vector<char> failed(chunks.size(), 0);
+        runParallel(chunks.size(), [&](size_t i) {
+            auto [index, offset] = chunks[i];
+            auto &upload = uploads[index];
+            failed[i] = !uploadPart(upload, offset, std::min(chunkSize, upload.size - offset));
+        });
+        auto copyEnd = std::chrono::steady_clock::now();
+
+        // Sections that failed are read by the loader as usual
+        for (size_t i = 0; i < chunks.size(); i++) {
+            if (failed[i])
+                uploads[chunks[i].first].bo.reset();
+        }
+
+        const std::lock_guard<std::mutex> lock(sectionsMtx);
+        for (auto &upload : uploads) {
+            if (upload.bo == nullptr)
+                continue;
+
+            if (upload.shared)
+                share(upload);
+            loadStats.sections++;
+            loadStats.copySize += upload.size;
+            prepared.emplace(
+                upload.offset,
+                PreparedSection{upload.size, upload.flags, upload.shared, std::move(upload.bo)});
+        }
+        size_t poolThreads = loadPool ? loadPool->getThreadCount() + 1 : 1;
+        loadStats.threads =
+            std::min<size_t>({loadThreads, poolThreads, std::max(uploads.size(), chunks.size())});
+        loadStats.allocUs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(copyStart - allocStart).count());
+        loadStats.copyUs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(copyEnd - copyStart).count());
+    }
+
+    /**
+     * Take section uploaded by preload
+     * @return nullptr if the section was not uploaded
+     */
+    std::unique_ptr<elf::ManagedBuffer> readPrepared(size_t offset,
+                                                     const elf::BufferSpecs &specs) {
+        const std::lock_guard<std::mutex> lock(sectionsMtx);
+        auto it = prepared.find(offset);
+        if (it == prepared.end())
+            return nullptr;
+
+        PreparedSection section = std::move(it->second);
+        prepared.erase(it);
+        if (section.size != specs.size || section.flags != specs.procFlags)
+            return nullptr;
+
+        std::unique_ptr<elf::BufferManager> manager;
+        if (section.shared)
+            manager = std::make_unique<SharedSectionBufferManager>(bufferManager,
+                                                                   std::move(section.bo),
+                                                                   specs,
+                                                                   blob + offset);
+        else
+            manager = std::make_unique<PreparedSectionBufferManager>(bufferManager,
+                                                                     std::move(section.bo));
+
+        auto buffer = std::make_unique<elf::AllocatedDeviceBuffer>(manager.get(), specs);
+        sectionManagers.push_back(std::move(manager));
+        return buffer;
+    }
+
     uint8_t *blob = nullptr;
+    VPU::OsFile *file = nullptr;
     DriverBufferManager *bufferManager = nullptr;
+    VPU::VPUDeviceContext *ctx = nullptr;
+    uint32_t loadThreads = 1;
+    // Graph creation pool of the driver, shared by the loads of all the graphs
+    VPU::ThreadPool *loadPool = nullptr;
+
+    // File offset and size of sections that are shared with other graphs
+    std::map<size_t, size_t> shareableSections;
+    // Section headers of the blob, sections with NPU access are uploaded by preload
+    std::vector<elf::SectionHeader> sectionHeaders;
+    std::once_flag preloadOnce;
+
+    std::mutex sectionsMtx;
+    std::map<size_t, PreparedSection> prepared;
+    LoadStats loadStats;
+    std::vector<std::unique_ptr<elf::BufferManager>> sectionManagers;
 };
 
 ElfParser::ElfParser(VPU::VPUDeviceContext *ctx,
@@ -337,30 +788,92 @@ static void loadHostParsedInference(const std::shared_ptr<elf::HostParsedInferen
     throw DriverError(ZE_RESULT_ERROR_UNKNOWN);
 }
 
-std::shared_ptr<elf::HostParsedInference> HostParsedInferenceManager::acquire() {
-    std::lock_guard<std::mutex> lock(mtx);
+void HostParsedInferenceManager::load() {
+    if (loaded)
+        return;
+
+    std::lock_guard<std::mutex> lock(copyMtx);
     if (!loaded) {
-        loadHostParsedInference(hpis.at(0));
+        loadStart = std::chrono::steady_clock::now();
+        loadHostParsedInference(first);
+        loadEnd = std::chrono::steady_clock::now();
         loaded = true;
     }
+}
 
-    for (auto &hpi : hpis) {
-        if (hpi.use_count() == 1)
-            return hpi;
+std::shared_ptr<elf::HostParsedInference>
+HostParsedInferenceManager::track(std::shared_ptr<elf::HostParsedInference> hpi) {
+    auto *ptr = hpi.get();
+    std::weak_ptr<FreeList> weakFreeList = freeList;
+    return std::shared_ptr<elf::HostParsedInference>(
+        ptr,
+        [weakFreeList, hpi = std::move(hpi)](elf::HostParsedInference *) mutable {
+            // Copy is released together with the deleter when the manager is already destroyed
+            if (auto list = weakFreeList.lock()) {
+                std::lock_guard<std::mutex> lock(list->mtx);
+                list->hpis.push_back(std::move(hpi));
+            }
+        });
+}
+
+std::shared_ptr<elf::HostParsedInference> HostParsedInferenceManager::acquire() {
+    load();
+
+    {
+        std::lock_guard<std::mutex> lock(freeList->mtx);
+        if (!freeList->hpis.empty()) {
+            auto hpi = std::move(freeList->hpis.back());
+            freeList->hpis.pop_back();
+            return track(std::move(hpi));
+        }
     }
 
-    auto hpi = copyHostParsedInference(hpis.at(0));
-    if (hpi != nullptr)
-        hpis.push_back(hpi);
-    return hpi;
+    // Copy allocates and uploads device buffers, other threads keep taking released copies
+    std::shared_ptr<elf::HostParsedInference> hpi;
+    {
+        std::lock_guard<std::mutex> lock(copyMtx);
+        hpi = copyHostParsedInference(first);
+    }
+    if (hpi == nullptr)
+        return nullptr;
+
+    count++;
+    LOG(GRAPH, "Created elf::HostParsedInference copy, total: %lu", count.load());
+    return track(std::move(hpi));
+}
+
+void HostParsedInferenceManager::reserve(size_t targetCount) {
+    load();
+
+    std::lock_guard<std::mutex> copyLock(copyMtx);
+    while (count < targetCount) {
+        auto hpi = copyHostParsedInference(first);
+        if (hpi == nullptr) {
+            LOG_W("Failed to pre-create elf::HostParsedInference, count: %lu", count.load());
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(freeList->mtx);
+        freeList->hpis.push_back(std::move(hpi));
+        count++;
+    }
+    LOG(GRAPH, "Pre-created elf::HostParsedInference copies, total: %lu", count.load());
 }
 
 std::unique_ptr<ElfParser> ElfParser::getElfParser(VPU::VPUDeviceContext *ctx,
                                                    const std::unique_ptr<BlobContainer> &blob,
                                                    std::string &logBuffer) {
     auto bufferManager = std::make_unique<DriverBufferManager>(ctx);
-    auto accessManager =
-        std::make_unique<ElfAccessManager>(blob->ptr, blob->size, bufferManager.get());
+    Driver *pDriver = Driver::getInstance();
+    bool shareSections = pDriver ? pDriver->getEnvVariables().shareGraphSections : true;
+    uint32_t loadThreads = pDriver ? pDriver->getEnvVariables().graphLoadThreads : 1;
+    VPU::ThreadPool *loadPool = loadThreads > 1 ? &pDriver->getGraphCreatePool() : nullptr;
+    auto accessManager = std::make_unique<ElfAccessManager>(*blob,
+                                                            bufferManager.get(),
+                                                            ctx,
+                                                            shareSections,
+                                                            loadThreads,
+                                                            loadPool);
     auto hpi = createHostParsedInference(bufferManager.get(), accessManager.get(), ctx, logBuffer);
     if (hpi != nullptr)
         return std::make_unique<ElfParser>(ctx,
@@ -749,8 +1262,7 @@ bool ElfParser::applyInputOutputs(std::shared_ptr<elf::HostParsedInference> &cmd
                 return false;
             }
 
-            uint64_t offset = reinterpret_cast<uint64_t>(ptrs[i]) -
-                              reinterpret_cast<uint64_t>(bo->getBasePointer());
+            uint64_t offset = bo->getVPUAddr(ptrs[i]) - bo->getVPUAddr();
 
             if (bo->getAllocSize() - offset < buffers[i].size()) {
                 LOG_E("Graph argument at position: %zu with size: %lu exceedes expected size: %lu",
@@ -816,6 +1328,11 @@ ElfParser::createInferenceExecuteCommand(const std::vector<const void *> &inputP
         return nullptr;
 
     std::shared_ptr<elf::HostParsedInference> cmdHpi = hpiManager->acquire();
+    if (cmdHpi == nullptr) {
+        LOG_E("Failed to acquire elf::HostParsedInference");
+        return nullptr;
+    }
+
     std::vector<std::shared_ptr<VPU::VPUBufferObject>> bos;
     auto hpiBuffer = cmdHpi->getParsedInference();
     auto bo = findBuffer(hpiBuffer.cpu_addr());
@@ -871,10 +1388,49 @@ ze_result_t ElfParser::parse(std::vector<ze_graph_argument_properties_3_t> &argu
 }
 
 ze_result_t ElfParser::initialize() {
+    Driver *pDriver = Driver::getInstance();
+    uint32_t instances = pDriver ? pDriver->getEnvVariables().graphInstances : 1;
+
+    auto *elfAccessManager = dynamic_cast<ElfAccessManager *>(accessManager.get());
     try {
-        hpiManager->acquire();
+        hpiManager->reserve(instances);
+
+        if (elfAccessManager != nullptr) {
+            // Sections that are not taken by the first copy would stay allocated with the parser
+            elfAccessManager->releasePrepared();
+
+            auto toUs = [](auto start, auto end) -> uint64_t {
+                if (end <= start)
+                    return 0;
+                return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+            };
+            auto loadStats = elfAccessManager->getLoadStats();
+            auto loadStart = hpiManager->getLoadStart();
+            auto loadEnd = hpiManager->getLoadEnd();
+            bool preloaded = loadStats.preloadEnd > loadStart;
+            LOG(GRAPH,
+                "Graph load time: %lu us, parse: %lu us, alloc: %lu us, copy: %lu us, "
+                "relocation: %lu us, uploaded sections: %lu, size: %lu, threads: %lu",
+                toUs(loadStart, loadEnd),
+                preloaded ? toUs(loadStart, loadStats.preloadStart) : 0,
+                loadStats.allocUs,
+                loadStats.copyUs,
+                preloaded ? toUs(loadStats.preloadEnd, loadEnd) : 0,
+                loadStats.sections,
+                loadStats.copySize,
+                loadStats.threads);
+        }
+
+        auto stats = ctx->getSharedBuffers().getStats();
+        LOG(GRAPH,
+            "Shared read only sections in context: %lu, size: %lu, saved: %lu",
+            stats.count,
+            stats.size,
+            stats.savedSize);
         return ZE_RESULT_SUCCESS;
     } catch (const DriverError &e) {
+        if (elfAccessManager != nullptr)
+            elfAccessManager->releasePrepared();
         return e.result();
     }
     return ZE_RESULT_ERROR_UNKNOWN;
@@ -15,6 +15,8 @@
 #include "vpu_driver/source/command/vpu_command.hpp"
 #include "vpux_elf/utils/version.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <level_zero/ze_api.h>
 #include <memory>
 #include <mutex>
@@ -37,18 +39,58 @@ namespace L0 {
 class BlobContainer;
 struct GraphProfilingQuery;
 
+/**
+ * Pool of elf::HostParsedInference copies of one graph. Every copy owns its own device buffers,
+ * so each inference that runs concurrently needs a separate copy. Idle copies are kept on a free
+ * list, a copy returns to the list when the last reference returned by acquire() is dropped.
+ */
 class HostParsedInferenceManager {
   public:
     HostParsedInferenceManager(std::shared_ptr<elf::HostParsedInference> hpi)
-        : hpis{std::move(hpi)} {}
+        : first(hpi)
+        , freeList(std::make_shared<FreeList>()) {
+        freeList->hpis.push_back(std::move(hpi));
+    }
+
+    std::shared_ptr<elf::HostParsedInference> &front() { return first; }
 
-    std::shared_ptr<elf::HostParsedInference> &front() { return hpis.at(0); }
+    /**
+     * Take a copy from the free list, a new copy is created if all of them are in use
+     */
     std::shared_ptr<elf::HostParsedInference> acquire();
 
+    /**
+     * Load the first copy and create new ones until there are at least count copies
+     */
+    void reserve(size_t count);
+
+    size_t size() const { return count.load(); }
+
+    /**
+     * Start and end of elf::HostParsedInference::load of the first copy, valid after reserve()
+     */
+    std::chrono::steady_clock::time_point getLoadStart() const { return loadStart; }
+    std::chrono::steady_clock::time_point getLoadEnd() const { return loadEnd; }
+
   private:
-    std::mutex mtx;
-    std::vector<std::shared_ptr<elf::HostParsedInference>> hpis;
-    bool loaded = false;
+    struct FreeList {
+        std::mutex mtx;
+        std::vector<std::shared_ptr<elf::HostParsedInference>> hpis;
+    };
+
+    void load();
+    std::shared_ptr<elf::HostParsedInference> track(std::shared_ptr<elf::HostParsedInference> hpi);
+
+    std::shared_ptr<elf::HostParsedInference> first;
+    std::shared_ptr<FreeList> freeList;
+    std::atomic<size_t> count = 1;
+
+    // Serializes load and copies of the first copy, the free list has its own lock
+    std::mutex copyMtx;
+    std::atomic<bool> loaded = false;
+    // Written under copyMtx before loaded is set
+    std::chrono::steady_clock::time_point loadStart;
+    std::chrono::steady_clock::time_point loadEnd;
 };
 
 class ElfParser : public IParser, public std::enable_shared_from_this<ElfParser> {
@@ -94,6 +136,9 @@ class ElfParser : public IParser, public std::enable_shared_from_this<ElfParser>
                            std::vector<std::shared_ptr<VPU::VPUBufferObject>> &bos);
     std::shared_ptr<VPU::VPUBufferObject> findBuffer(const void *ptr);
 
+    HostParsedInferenceManager &getHostParsedInferenceManager() { return *hpiManager; }
+    elf::AccessManager &getAccessManager() { return *accessManager; }
+
   private:
     VPU::VPUDeviceContext *ctx;
     std::unique_ptr<elf::BufferManager> bufferManager;
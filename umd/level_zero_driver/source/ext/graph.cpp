@@ -18,16 +18,21 @@
 #include "level_zero_driver/source/context.hpp"
 #include "level_zero_driver/source/device.hpp"
 #include "level_zero_driver/source/driver.hpp"
+#include "level_zero_driver/source/event.hpp"
 #include "npu_driver_compiler.h"
 #include "profiling_data.hpp"
 #include "umd_common.hpp"
+#include "vpu_driver/source/command/vpu_event_command.hpp"
 #include "vpu_driver/source/device/hw_info.hpp"
 #include "vpu_driver/source/device/vpu_device.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
+#include "vpu_driver/source/utilities/thread_pool.hpp"
 #include "vpux_elf/utils/version.hpp"
 #include "vpux_hpi.hpp"
 
 #include <algorithm>
+#include <exception>
+#include <functional>
 #include <memory>
 #include <string.h>
 #include <string>
@@ -37,10 +42,7 @@
 namespace L0 {
 static thread_local std::string lastFailLog;
 
-GraphBuildLog::GraphBuildLog(Context *pCtx)
-    : pContext(pCtx){};
-
-ze_result_t GraphBuildLog::getLogString(uint32_t *pSize, char *pBuildLog) {
+static ze_result_t copyLog(const std::string &log, uint32_t *pSize, char *pBuildLog) {
     if (pSize == nullptr) {
         LOG_E("Input size pointer is NULL");
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
@@ -55,6 +57,13 @@ ze_result_t GraphBuildLog::getLogString(uint32_t *pSize, char *pBuildLog) {
     return ZE_RESULT_SUCCESS;
 }
 
+GraphBuildLog::GraphBuildLog(Context *pCtx)
+    : pContext(pCtx){};
+
+ze_result_t GraphBuildLog::getLogString(uint32_t *pSize, char *pBuildLog) {
+    return copyLog(log, pSize, pBuildLog);
+}
+
 ze_result_t GraphBuildLog::destroy() {
     pContext->removeObject(this);
     return ZE_RESULT_SUCCESS;
@@ -68,6 +77,23 @@ Graph::Graph(Context *pCtx, const ze_graph_desc_2_t *pDesc, std::string &log)
     initialize(log);
 }
 
+Graph::Graph(Context *pCtx, const ze_graph_desc_2_t *pDesc)
+    : pContext(pCtx)
+    , ctx(pCtx->getDeviceContext())
+    , desc(*pDesc)
+    , buildFlags(desc.pBuildFlags != nullptr ? desc.pBuildFlags : "")
+    , created(false) {
+    // Build flags may be released by the caller before the creation starts
+    if (desc.pBuildFlags != nullptr)
+        desc.pBuildFlags = buildFlags.c_str();
+}
+
+Graph::~Graph() {
+    // Lock is taken also after the creation, the worker may still be releasing it
+    std::unique_lock<std::mutex> lock(createMtx);
+    createCondition.wait(lock, [this] { return created.load(); });
+}
+
 ze_result_t Graph::create(const ze_context_handle_t hContext,
                           const ze_device_handle_t hDevice,
                           const ze_graph_desc_2_t *pDesc,
@@ -97,6 +123,8 @@ ze_result_t Graph::create(const ze_context_handle_t hContext,
     }
     try {
         auto pGraph = std::make_unique<Graph>(Context::fromHandle(hContext), pDesc, logBuffer);
+        /* Cache status is stored also in fail log due to back compatibility */
+        lastFailLog = pGraph->cacheStatus;
         *phGraph = pGraph.get();
         Context::fromHandle(hContext)->appendObject(std::move(pGraph));
 
@@ -108,6 +136,98 @@ ze_result_t Graph::create(const ze_context_handle_t hContext,
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t Graph::createAsync(const ze_context_handle_t hContext,
+                               const ze_device_handle_t hDevice,
+                               const ze_graph_desc_2_t *pDesc,
+                               ze_event_handle_t hSignalEvent,
+                               ze_graph_handle_t *phGraph) {
+    if (pDesc == nullptr) {
+        LOG_E("Invalid graph descriptor");
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (phGraph == nullptr) {
+        LOG_E("Invalid graph pointer to handle");
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    auto pCtx = Context::fromHandle(hContext)->getDeviceContext();
+    if (pCtx == nullptr) {
+        LOG_E("Device Context failed to be retrieved");
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    auto pGraph = std::make_unique<Graph>(Context::fromHandle(hContext), pDesc);
+    Graph *graph = pGraph.get();
+    Context::fromHandle(hContext)->appendObject(std::move(pGraph));
+    *phGraph = graph->toHandle();
+
+    // Task references the event memory instead of the event, the memory stays valid even if
+    // the event or its pool is destroyed before the creation is finished
+    std::function<void()> signal;
+    if (hSignalEvent != nullptr) {
+        Event *event = Event::fromHandle(hSignalEvent);
+        signal = [bo = event->getAssociatedBo(), state = event->getSyncPointer()]() {
+            if (bo != nullptr)
+                *state = VPU::VPUEventCommand::STATE_HOST_SIGNAL;
+        };
+    }
+    Driver::getInstance()->getGraphCreatePool().enqueue(
+        [graph, signal = std::move(signal)]() mutable {
+            graph->finishCreation(std::move(signal));
+        });
+
+    LOG(GRAPH, "Graph creation queued - %p", *phGraph);
+    return ZE_RESULT_SUCCESS;
+}
+
+void Graph::finishCreation(std::function<void()> signal) {
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    try {
+        initialize(createLog);
+        // Load is done here as well, zeGraphInitialize only reuses the loaded graph
+        result = parser->initialize();
+    } catch (const DriverError &err) {
+        result = err.result();
+    } catch (const std::exception &e) {
+        LOG_E("Exception caught, msg: '%s'", e.what());
+        result = ZE_RESULT_ERROR_UNKNOWN;
+    }
+
+    if (result == ZE_RESULT_SUCCESS)
+        LOG(GRAPH, "Graph created asynchronously - %p", this);
+    else
+        LOG_E("Asynchronous creation of graph %p failed, result: %#x", this, result);
+
+    // Event is signaled and its memory released first, the graph and the context may be
+    // destroyed as soon as created is set
+    if (signal) {
+        signal();
+        signal = nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(createMtx);
+    createResult = result;
+    created.store(true, std::memory_order_release);
+    createCondition.notify_all();
+}
+
+ze_result_t Graph::waitForCreation() {
+    if (!created.load(std::memory_order_acquire)) {
+        std::unique_lock<std::mutex> lock(createMtx);
+        createCondition.wait(lock, [this] { return created.load(); });
+    }
+
+    if (createResult != ZE_RESULT_SUCCESS)
+        LOG_E("Graph %p failed to be created, result: %#x", this, createResult);
+    return createResult;
+}
+
+ze_result_t Graph::getCreateLog(uint32_t *pSize, char *pBuildLog) {
+    waitForCreation();
+    return copyLog(createLog, pSize, pBuildLog);
+}
+
 ze_result_t Graph::destroy() {
     pContext->removeObject(this);
     LOG(GRAPH, "Graph destroyed - %p", this);
@@ -402,11 +522,14 @@ void Graph::initialize(std::string &log) {
         if (!(desc.flags & ZE_GRAPH_FLAG_DISABLE_CACHING)) {
             key = cache.computeKey(desc);
             blob = cache.getBlob(key);
+            if (blob && !loadCachedBlob(log)) {
+                cache.removeBlob(key);
+                blob.reset();
+            }
             if (blob) {
                 propFlags = ZE_GRAPH_PROPERTIES_FLAG_LOADED_FROM_CACHE;
                 log += "ZE DynamicCaching cache_status_t: cache_status_t::found\n";
-                /* Cache status is stored also in fail log due to back compatibility */
-                lastFailLog = "ZE DynamicCaching cache_status_t: cache_status_t::found\n";
+                cacheStatus = "ZE DynamicCaching cache_status_t: cache_status_t::found\n";
             }
         }
 
@@ -421,8 +544,7 @@ void Graph::initialize(std::string &log) {
             if (!(desc.flags & ZE_GRAPH_FLAG_DISABLE_CACHING)) {
                 cache.setBlob(key, blob);
                 log += "ZE DynamicCaching cache_status_t: cache_status_t::stored\n";
-                /* Cache status is stored also in fail log due to back compatibility */
-                lastFailLog = "ZE DynamicCaching cache_status_t: cache_status_t::stored\n";
+                cacheStatus = "ZE DynamicCaching cache_status_t: cache_status_t::stored\n";
             }
         }
         break;
@@ -432,6 +554,11 @@ void Graph::initialize(std::string &log) {
         throw DriverError(ZE_RESULT_ERROR_INVALID_ARGUMENT);
     }
 
+    if (parser == nullptr)
+        createParser(log);
+}
+
+void Graph::createParser(std::string &log) {
     if (ElfParser::checkMagic(blob)) {
         LOG(GRAPH, "Detected Elf format");
         parser = ElfParser::getElfParser(ctx, blob, log);
@@ -457,6 +584,29 @@ void Graph::initialize(std::string &log) {
     }
 }
 
+/**
+ * Parse blob from the disk cache, the sections are loaded at the first use of the graph
+ * @return false if the blob cannot be parsed and has to be compiled again
+ */
+bool Graph::loadCachedBlob(std::string &log) {
+    try {
+        createParser(log);
+        return true;
+    } catch (const std::exception &e) {
+        LOG(CACHE, "Failed to parse cached blob, compiling the graph again, reason: %s", e.what());
+    } catch (...) {
+        LOG(CACHE, "Failed to parse cached blob, compiling the graph again");
+    }
+
+    parser.reset();
+    inputArgs.clear();
+    outputArgs.clear();
+    argumentProperties.clear();
+    argumentMetadata.clear();
+    profilingOutputSize = 0;
+    return false;
+}
+
 ze_result_t Graph::parserInitialize() {
     return parser->initialize();
 }
@@ -471,20 +621,7 @@ Graph::allocateGraphExecuteCommand(GraphProfilingQuery *profilingQuery) {
 }
 
 ze_result_t Graph::getLogString(uint32_t *pSize, char *pBuildLog) {
-    if (pSize == nullptr) {
-        LOG_E("Input size pointer is NULL");
-        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
-    }
-
-    if (pBuildLog == nullptr) {
-        *pSize = static_cast<uint32_t>(lastFailLog.size() + 1);
-        return ZE_RESULT_SUCCESS;
-    }
-
-    *pSize = std::min(*pSize, static_cast<uint32_t>(lastFailLog.size() + 1));
-    memcpy(pBuildLog, lastFailLog.c_str(), *pSize);
-
-    return ZE_RESULT_SUCCESS;
+    return copyLog(lastFailLog, pSize, pBuildLog);
 }
 
 ze_result_t Graph::getSupportedOptions(ze_device_handle_t hDevice,
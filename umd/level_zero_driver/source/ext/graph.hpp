@@ -17,7 +17,11 @@
 #include <level_zero/ze_api.h>
 #include <level_zero/ze_graph_ext.h>
 #include <level_zero/ze_graph_profiling_ext.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -53,13 +57,37 @@ struct GraphBuildLog : _ze_graph_build_log_handle_t, IContextObject {
 
 struct Graph : _ze_graph_handle_t, IContextObject {
     Graph(Context *pCtx, const ze_graph_desc_2_t *pDesc, std::string &log);
-    ~Graph() = default;
+    /**
+     * Constructor of the asynchronous path, the graph is created later by finishCreation()
+     */
+    Graph(Context *pCtx, const ze_graph_desc_2_t *pDesc);
+    ~Graph();
 
     static ze_result_t create(const ze_context_handle_t hContext,
                               const ze_device_handle_t hDevice,
                               const ze_graph_desc_2_t *pDesc,
                               ze_graph_handle_t *phGraph,
                               ze_graph_build_log_handle_t *phGraphBuildLog = nullptr);
+    /**
+     * Returns the handle immediately, compilation or cache lookup, parsing and loading run on the
+     * driver graph creation pool. hSignalEvent is signaled when the creation is finished, also on
+     * failure, so the result has to be checked with waitForCreation(). The ze_graph API entry
+     * points and command list appends wait for the creation before using the graph.
+     */
+    static ze_result_t createAsync(const ze_context_handle_t hContext,
+                                   const ze_device_handle_t hDevice,
+                                   const ze_graph_desc_2_t *pDesc,
+                                   ze_event_handle_t hSignalEvent,
+                                   ze_graph_handle_t *phGraph);
+    /**
+     * Blocks until the asynchronous creation is finished
+     * @return result of the creation, ZE_RESULT_SUCCESS for synchronously created graph
+     */
+    ze_result_t waitForCreation();
+    /**
+     * Log of the asynchronous creation, blocks until the creation is finished
+     */
+    ze_result_t getCreateLog(uint32_t *pSize, char *pBuildLog);
     ze_result_t destroy();
     ze_result_t getNativeBinary(size_t *pSize, uint8_t *pGraphNativeBinary);
     ze_result_t getNativeBinary2(size_t *pSize, const uint8_t **pGraphNativeBinary);
@@ -111,6 +139,9 @@ struct Graph : _ze_graph_handle_t, IContextObject {
 
   private:
     void initialize(std::string &log);
+    void createParser(std::string &log);
+    bool loadCachedBlob(std::string &log);
+    void finishCreation(std::function<void()> signal);
     void addDeviceConfigToBuildFlags();
 
     Context *pContext;
@@ -119,6 +150,7 @@ struct Graph : _ze_graph_handle_t, IContextObject {
     std::string buildFlags;
     std::unique_ptr<BlobContainer> blob;
     ze_graph_properties_flags_t propFlags = 0;
+    std::string cacheStatus;
 
     std::vector<const void *> inputArgs;
     std::vector<const void *> outputArgs;
@@ -129,6 +161,12 @@ struct Graph : _ze_graph_handle_t, IContextObject {
 
     std::shared_ptr<IParser> parser = nullptr;
     std::unordered_map<void *, std::unique_ptr<GraphProfilingPool>> profilingPools;
+
+    std::mutex createMtx;
+    std::condition_variable createCondition;
+    std::atomic<bool> created = true;
+    ze_result_t createResult = ZE_RESULT_SUCCESS;
+    std::string createLog;
 };
 
 } // namespace L0
@@ -5,11 +5,14 @@
  *
  */
 
+// IWYU pragma: no_include <bits/chrono.h>
+
 #include "immediate_cmdlist.hpp"
 
 #include "cmdlist.hpp"
 #include "cmdqueue.hpp"
 #include "context.hpp"
+#include "driver.hpp"
 #include "event.hpp"
 #include "level_zero_driver/include/l0_exception.hpp"
 #include "level_zero_driver/include/l0_handler.hpp"
@@ -18,14 +21,28 @@
 #include "vpu_driver/source/device/vpu_device_context.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
+#include <chrono> // IWYU pragma: keep
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 namespace L0 {
 ImmediateCommandList::ImmediateCommandList(Context *pCtx, CommandQueue *pCmdQueue)
     : CommandList(pCtx, false)
-    , pCommandQueue(pCmdQueue) {}
+    , pCommandQueue(pCmdQueue) {
+    Driver *pDriver = Driver::getInstance();
+    if (pDriver == nullptr)
+        return;
+
+    const auto &env = pDriver->getEnvVariables();
+    if (env.immediateInFlightMax > 1)
+        maxJobsInFlight = env.immediateInFlightMax;
+    // Appends to synchronous queue are expected to complete before they return
+    if (env.immediateBatchSize > 1 && !(pCommandQueue && pCommandQueue->isSynchronous()))
+        maxBatchCommands = env.immediateBatchSize;
+    batchWindow = std::chrono::microseconds(env.immediateBatchWindowUs);
+}
 
 ze_result_t ImmediateCommandList::create(ze_context_handle_t hContext,
                                          ze_device_handle_t hDevice,
@@ -71,6 +88,9 @@ ze_result_t ImmediateCommandList::create(ze_context_handle_t hContext,
 }
 
 ze_result_t ImmediateCommandList::destroy() {
+    if (flush() != ZE_RESULT_SUCCESS)
+        LOG_W("Failed to submit pending commands of immediate command list %p", this);
+
     if (pCommandQueue) {
         pCommandQueue->destroy();
     }
@@ -87,18 +107,33 @@ ze_result_t ImmediateCommandList::isImmediate(ze_bool_t *pIsImmediate) {
 }
 
 ze_result_t ImmediateCommandList::checkCommandAppendCondition() {
-    ze_result_t result;
-
-    result = pCommandQueue->synchronize(std::numeric_limits<uint64_t>::max());
+    ze_result_t result = ZE_RESULT_SUCCESS;
 
     if (!vpuJob || vpuJob->isClosed()) {
         reset();
     }
+
+    // Jobs in flight are checked when a new batch starts
+    if (vpuJob->getNumCommands() != 0)
+        return result;
+
+    if (maxJobsInFlight > 1)
+        result = pCommandQueue->waitForJobsInFlight(maxJobsInFlight - 1,
+                                                    std::numeric_limits<uint64_t>::max());
+    else
+        result = pCommandQueue->synchronize(std::numeric_limits<uint64_t>::max());
+
+    batchStart = std::chrono::steady_clock::now();
     return result;
 }
 
 ze_result_t ImmediateCommandList::hostSynchronize(uint64_t timeout) {
-    ze_result_t result = pCommandQueue->synchronize(timeout);
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
+    ze_result_t result = flush();
+    if (result != ZE_RESULT_SUCCESS)
+        return result;
+
+    result = pCommandQueue->synchronize(timeout);
     if (result == ZE_RESULT_SUCCESS) {
         reset();
     }
@@ -106,6 +141,7 @@ ze_result_t ImmediateCommandList::hostSynchronize(uint64_t timeout) {
 }
 
 ze_result_t ImmediateCommandList::appendSignalEvent(ze_event_handle_t hEvent) {
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
     auto event = Event::fromHandle(hEvent);
     if (event == nullptr) {
         LOG_E("Failed to get event handle");
@@ -131,6 +167,7 @@ ze_result_t ImmediateCommandList::appendSignalEvent(ze_event_handle_t hEvent) {
 
 ze_result_t ImmediateCommandList::appendWaitOnEvents(uint32_t numEvents,
                                                      ze_event_handle_t *phEvent) {
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
     if (phEvent == nullptr)
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
 
@@ -162,21 +199,73 @@ ze_result_t ImmediateCommandList::appendWaitOnEvents(uint32_t numEvents,
 }
 
 ze_result_t ImmediateCommandList::postAppend() {
-    if (pCommandQueue) {
-        ze_command_list_handle_t thisList = this;
-        ze_result_t result;
+    if (pCommandQueue == nullptr)
+        return ZE_RESULT_SUCCESS;
 
-        if (!vpuJob->closeCommands()) {
-            LOG_E("Failed to close commands on immediate command list");
-            return ZE_RESULT_ERROR_INVALID_SYNCHRONIZATION_OBJECT;
-        }
-        result = pCommandQueue->executeCommandLists(1, &thisList, nullptr);
-        if (result != ZE_RESULT_SUCCESS) {
-            LOG_E("Immediate command list execution failed");
-            return result;
-        }
-        vpuJob = std::make_shared<VPU::VPUJob>(ctx);
+    if (maxBatchCommands > 1 && !isBatchComplete()) {
+        pContext->addPendingBatch(this, batchStart + batchWindow);
+        return ZE_RESULT_SUCCESS;
     }
+
+    return flush();
+}
+
+bool ImmediateCommandList::isBatchComplete() const {
+    if (vpuJob->getNumCommands() >= maxBatchCommands)
+        return true;
+
+    // Signaled event may be waited for by the host or by another queue
+    const auto &commands = vpuJob->getCommands();
+    if (!commands.empty() && commands.back()->getCommandType() == VPU_CMD_FENCE_SIGNAL)
+        return true;
+
+    return std::chrono::steady_clock::now() - batchStart >= batchWindow;
+}
+
+ze_result_t ImmediateCommandList::flush() {
+    const std::lock_guard<std::recursive_mutex> lock(appendMutex);
+    if (maxBatchCommands > 1)
+        pContext->removePendingBatch(this);
+
+    return submitBatch();
+}
+
+bool ImmediateCommandList::trySubmitBatch() {
+    std::unique_lock<std::recursive_mutex> lock(appendMutex, std::try_to_lock);
+    if (!lock.owns_lock())
+        return false;
+
+    if (submitBatch() != ZE_RESULT_SUCCESS)
+        LOG_W("Failed to submit pending commands of immediate command list %p", this);
+    return true;
+}
+
+ze_result_t ImmediateCommandList::submitBatch() {
+    if (pCommandQueue == nullptr || vpuJob->isClosed() || vpuJob->getNumCommands() == 0)
+        return ZE_RESULT_SUCCESS;
+
+    ze_command_list_handle_t thisList = this;
+    ze_result_t result;
+
+    // Job that is no longer tracked by the queue has completed and needs no ordering
+    if (maxJobsInFlight > 1)
+        vpuJob->setPrecedingJob(lastJob.lock());
+
+    if (!vpuJob->closeCommands()) {
+        LOG_E("Failed to close commands on immediate command list");
+        return ZE_RESULT_ERROR_INVALID_SYNCHRONIZATION_OBJECT;
+    }
+    result = pCommandQueue->executeCommandLists(1, &thisList, nullptr);
+    if (result != ZE_RESULT_SUCCESS) {
+        LOG_E("Immediate command list execution failed");
+        return result;
+    }
+
+    if (maxJobsInFlight > 1)
+        lastJob = vpuJob;
+
+    LOG(CMDLIST, "Immediate command list %p submitted %zu commands", this, getNumCommands());
+    vpuJob = std::make_shared<VPU::VPUJob>(ctx);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -6,11 +6,20 @@
  */
 
 #pragma once
+
+// IWYU pragma: no_include <bits/chrono.h>
+
 #include <stdint.h>
 
 #include "cmdlist.hpp"
 
+#include <chrono> // IWYU pragma: keep
 #include <level_zero/ze_api.h>
+#include <memory>
+
+namespace VPU {
+class VPUJob;
+} // namespace VPU
 
 namespace L0 {
 struct CommandQueue;
@@ -30,10 +39,36 @@ struct ImmediateCommandList : public CommandList {
     ze_result_t appendSignalEvent(ze_event_handle_t hEvent) override;
     ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent) override;
 
+    /**
+     * Submit commands appended since the last submission
+     */
+    ze_result_t flush();
+
+    /**
+     * Submit the pending batch unless another thread is appending to the command list. Called by
+     * the context that tracks the batch, the context stops tracking it on success.
+     * @return false if the command list is in use
+     */
+    bool trySubmitBatch();
+
   protected:
     ze_result_t checkCommandAppendCondition() override;
     ze_result_t postAppend() override;
+    bool isBatchComplete() const;
+    ze_result_t submitBatch();
 
     CommandQueue *pCommandQueue = nullptr;
+
+    // With more than one job in flight the jobs are ordered on the device by the completion
+    // fence of the previously submitted job
+    uint32_t maxJobsInFlight = 1;
+    std::weak_ptr<VPU::VPUJob> lastJob;
+
+    // Appends are collected into one job until it has maxBatchCommands commands, the batch window
+    // passes or an event is signaled. Batch that is still open when the window passes is
+    // submitted by the context, host synchronization submits it earlier.
+    uint32_t maxBatchCommands = 1;
+    std::chrono::microseconds batchWindow{0};
+    std::chrono::steady_clock::time_point batchStart;
 };
 } // namespace L0
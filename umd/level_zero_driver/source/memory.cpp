@@ -46,7 +46,7 @@ ze_result_t Context::checkMemInputs(VPU::VPUBufferObject::Location location,
     }
 
     // Checking that alignment is to power 2
-    // Note: Alignment value not used in VPU implementation
+    // Note: CPU mapping is page aligned, bigger alignment value is not used in VPU implementation
     if ((alignment & (alignment - 1)) != 0)
         return ZE_RESULT_ERROR_UNSUPPORTED_ALIGNMENT;
 
@@ -60,12 +60,16 @@ ze_result_t Context::allocMemory(size_t size,
                                  size_t alignment,
                                  void **ptr,
                                  VPU::VPUBufferObject::Location location,
-                                 VPU::VPUBufferObject::Type type) {
+                                 VPU::VPUBufferObject::Type type,
+                                 bool prefault) {
     ze_result_t ret = checkMemInputs(location, size, alignment, ptr);
     if (ret != ZE_RESULT_SUCCESS)
         return ret;
 
-    *ptr = ctx->createMemAlloc(size, type, location);
+    auto mapping = prefault ? VPU::VPUBufferObject::Mapping::Populate
+                            : VPU::VPUBufferObject::Mapping::Immediate;
+
+    *ptr = ctx->createMemAlloc(size, type, location, mapping);
 
     if (*ptr == nullptr) {
         LOG_E("Failed to allocate device memory");
@@ -13,6 +13,7 @@
 #include "umd_common.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/memory/vpu_slab_allocator.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
 #include <string.h>
@@ -50,7 +51,7 @@ MetricQueryPool::MetricQueryPool(Context *pContext,
     , metricQueries(poolSize) {
     size_t bufferSize = getMetricQueryAddrTableOffset(poolSize, metricGroup);
     pQueryPoolBuffer =
-        ctx->createUntrackedBufferObject(bufferSize, VPU::VPUBufferObject::Type::CachedFw);
+        ctx->createUntrackedBufferChunk(bufferSize, VPU::VPUBufferObject::Type::CachedFw);
     L0_THROW_WHEN(pQueryPoolBuffer == nullptr,
                   "Failed to allocate buffer object for metric query pool",
                   ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY);
@@ -110,7 +111,7 @@ ze_result_t MetricQueryPool::createMetricQuery(uint32_t index,
         std::make_unique<MetricQuery>(metricGroup,
                                       addressTablePtr,
                                       dataPtr,
-                                      pQueryPoolBuffer,
+                                      pQueryPoolBuffer->getBufferObject(),
                                       [this, index]() { metricQueries[index].reset(); });
 
     *phMetricQuery = metricQueries[index].get();
@@ -23,6 +23,7 @@ namespace L0 {
 struct Context;
 } // namespace L0
 namespace VPU {
+class VPUBufferChunk;
 class VPUBufferObject;
 class VPUDeviceContext;
 } // namespace VPU
@@ -50,7 +51,7 @@ struct MetricQueryPool : _zet_metric_query_pool_handle_t, IContextObject {
     VPU::VPUDeviceContext *ctx = nullptr;
     MetricGroup &metricGroup;
     std::vector<std::unique_ptr<MetricQuery>> metricQueries;
-    std::shared_ptr<VPU::VPUBufferObject> pQueryPoolBuffer = nullptr;
+    std::shared_ptr<VPU::VPUBufferChunk> pQueryPoolBuffer = nullptr;
 };
 
 struct MetricQuery : _zet_metric_query_handle_t {
@@ -49,6 +49,13 @@ struct Mock<Driver> : public Driver {
     void setAffinityMask(std::string_view value) { envVariables.affinityMask = value; }
     void setPciDeviceOrder(bool value) { envVariables.pciIdDeviceOrder = value; }
     void setSharedForceDeviceAlloc(bool value) { envVariables.sharedForceDeviceAlloc = value; }
+    void setImmediateBatch(uint32_t size, uint32_t windowUs) {
+        envVariables.immediateBatchSize = size;
+        envVariables.immediateBatchWindowUs = windowUs;
+    }
+    void setGraphInstances(uint32_t value) { envVariables.graphInstances = value; }
+    void setGraphLoadThreads(uint32_t value) { envVariables.graphLoadThreads = value; }
+    void setGraphCreateThreads(uint32_t value) { envVariables.graphCreateThreads = value; }
     void initializeEnvVariables() { Driver::initializeEnvVariables(); }
     void initializeLogging() { Driver::initializeLogging(); }
 
@@ -5,16 +5,20 @@
  *
  */
 
+// IWYU pragma: no_include <bits/chrono.h>
+
 #include <stddef.h>
 #include <stdint.h>
 
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "gtest/gtest.h"
 #include "level_zero_driver/source/cmdlist.hpp"
+#include "level_zero_driver/source/cmdqueue.hpp"
 #include "level_zero_driver/source/context.hpp"
 #include "level_zero_driver/source/device.hpp"
 #include "level_zero_driver/source/event.hpp"
 #include "level_zero_driver/source/eventpool.hpp"
+#include "level_zero_driver/source/immediate_cmdlist.hpp"
 #include "level_zero_driver/unit_tests/fixtures/device_fixture.hpp"
 #include "level_zero_driver/unit_tests/mocks/mock_driver.hpp"
 #include "vpu_driver/source/command/vpu_command.hpp"
@@ -23,9 +27,11 @@
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 #include "vpu_driver/unit_tests/test_macros/test.hpp"
 
+#include <chrono> // IWYU pragma: keep
 #include <level_zero/ze_api.h>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace L0 {
@@ -323,7 +329,7 @@ TEST_F(CommandListCommitSizeTest, timeStampAndS2lCopyCommandsWithEvents) {
 
     /* Timestamp is split by UMD to two commands aligned TS and copy */
     EXPECT_EQ(8u, nnCmdlist->getNumCommands());
-    EXPECT_EQ(2u, nnCmdlist->getJob()->getCommandBuffers().size());
+    EXPECT_EQ(1u, nnCmdlist->getJob()->getCommandBuffers().size());
 }
 
 TEST_F(CommandListCommitSizeTest, l2lCopyAndL2SCopyCommands) {
@@ -374,8 +380,118 @@ TEST_F(CommandListCommitSizeTest, l2lCopyAndL2SCopyCommandsWithEvents) {
     EXPECT_EQ(6u, nnCmdlist->getNumCommands());
 
     ASSERT_EQ(ZE_RESULT_SUCCESS, nnCmdlist->close());
-    /* Only Compute should be used */
-    EXPECT_EQ(2u, nnCmdlist->getJob()->getCommandBuffers().size());
+    /* Signal events are inline, only single Compute buffer should be used */
+    EXPECT_EQ(1u, nnCmdlist->getJob()->getCommandBuffers().size());
+}
+
+struct ImmediateCommandListBatchTest : public Test<CommandQueueFixture> {
+    void SetUp() override {
+        // Batch is not closed by the window during the test
+        driver.setImmediateBatch(4, UINT32_MAX);
+        CommandQueueFixture::SetUp();
+
+        ASSERT_EQ(ZE_RESULT_SUCCESS,
+                  L0::ImmediateCommandList::create(context, device, &queueDesc, &hCmdList));
+        cmdList = L0::CommandList::fromHandle(hCmdList);
+
+        ze_event_pool_desc_t evPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+                                           nullptr,
+                                           ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+                                           1};
+        ze_device_handle_t hDevice = device->toHandle();
+        ASSERT_EQ(ZE_RESULT_SUCCESS,
+                  L0::EventPool::create(context, &evPoolDesc, 1, &hDevice, &hEvPool));
+        ze_event_desc_t evDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC,
+                                  nullptr,
+                                  0,
+                                  0,
+                                  ZE_EVENT_SCOPE_FLAG_HOST};
+        ASSERT_EQ(ZE_RESULT_SUCCESS,
+                  L0::EventPool::fromHandle(hEvPool)->createEvent(&evDesc, &hEvent));
+    }
+
+    void TearDown() override {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, L0::Event::fromHandle(hEvent)->destroy());
+        EXPECT_EQ(ZE_RESULT_SUCCESS, L0::EventPool::fromHandle(hEvPool)->destroy());
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->destroy());
+        CommandQueueFixture::TearDown();
+    }
+
+    ze_command_queue_desc_t queueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC,
+                                         nullptr,
+                                         0,
+                                         0,
+                                         0,
+                                         ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS,
+                                         ZE_COMMAND_QUEUE_PRIORITY_NORMAL};
+    ze_command_list_handle_t hCmdList = nullptr;
+    L0::CommandList *cmdList = nullptr;
+    ze_event_pool_handle_t hEvPool = nullptr;
+    ze_event_handle_t hEvent = nullptr;
+};
+
+TEST_F(ImmediateCommandListBatchTest, trailingAppendIsSubmittedWhenEventIsQueried) {
+    ASSERT_EQ(ZE_RESULT_SUCCESS, cmdList->appendBarrier(nullptr, 0, nullptr));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, cmdList->appendWaitOnEvents(1, &hEvent));
+    EXPECT_EQ(0u, osInfc.callCntSubmit);
+
+    // Host waits for the event without signaling it from the batch
+    L0::Event::fromHandle(hEvent)->queryStatus();
+    EXPECT_EQ(1u, osInfc.callCntSubmit);
+
+    L0::Event::fromHandle(hEvent)->queryStatus();
+    EXPECT_EQ(1u, osInfc.callCntSubmit);
+}
+
+TEST_F(ImmediateCommandListBatchTest, trailingAppendIsSubmittedWhenQueueIsSynchronized) {
+    ze_command_queue_handle_t hCommandQueue = createCommandQueue();
+    ASSERT_NE(nullptr, hCommandQueue);
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, cmdList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(0u, osInfc.callCntSubmit);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::CommandQueue::fromHandle(hCommandQueue)->synchronize(0));
+    EXPECT_EQ(1u, osInfc.callCntSubmit);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::CommandQueue::fromHandle(hCommandQueue)->destroy());
+}
+
+TEST_F(ImmediateCommandListBatchTest, batchIsSubmittedByWaitOnAnotherThread) {
+    ASSERT_EQ(ZE_RESULT_SUCCESS, cmdList->appendBarrier(nullptr, 0, nullptr));
+
+    std::thread([this] { L0::Event::fromHandle(hEvent)->queryStatus(); }).join();
+    EXPECT_EQ(1u, osInfc.callCntSubmit);
+}
+
+TEST_F(ImmediateCommandListBatchTest, batchIsSubmittedWhenWindowPasses) {
+    driver.setImmediateBatch(4, 1000);
+    ze_command_list_handle_t hWindowCmdList = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS,
+              L0::ImmediateCommandList::create(context, device, &queueDesc, &hWindowCmdList));
+    auto windowCmdList = L0::CommandList::fromHandle(hWindowCmdList);
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, windowCmdList->appendBarrier(nullptr, 0, nullptr));
+
+    // Nothing is appended or waited for, the batch is submitted by the context
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (context->hasPendingBatches() && std::chrono::steady_clock::now() < timeout)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_FALSE(context->hasPendingBatches());
+    EXPECT_EQ(1u, osInfc.callCntSubmit);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, windowCmdList->destroy());
+}
+
+TEST_F(ImmediateCommandListBatchTest, fullBatchIsSubmittedOnAppend) {
+    for (int i = 0; i < 3; i++)
+        ASSERT_EQ(ZE_RESULT_SUCCESS, cmdList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(0u, osInfc.callCntSubmit);
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, cmdList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(1u, osInfc.callCntSubmit);
+
+    L0::Event::fromHandle(hEvent)->queryStatus();
+    EXPECT_EQ(1u, osInfc.callCntSubmit);
 }
 
 } // namespace ult
@@ -16,12 +16,14 @@
 #include "level_zero_driver/source/event.hpp"
 #include "level_zero_driver/source/eventpool.hpp"
 #include "level_zero_driver/unit_tests/fixtures/device_fixture.hpp"
+#include "vpu_driver/source/command/vpu_job.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 #include "vpu_driver/unit_tests/mocks/mock_os_interface_imp.hpp"
 #include "vpu_driver/unit_tests/test_macros/test.hpp"
 
 #include <level_zero/ze_api.h>
+#include <memory>
 #include <string>
 
 namespace L0 {
@@ -437,5 +439,38 @@ TEST_F(CommandQueueJobTest, multipleJobsMaintainedInSingleSubmitId) {
     ASSERT_TRUE(ctx->freeMemAlloc(dstHostMem));
 }
 
+TEST_F(CommandQueueJobTest, fusedJobIsDroppedWhenCommandListIsReset) {
+    uint64_t *tsDest =
+        static_cast<uint64_t *>(ctx->createMemAlloc(memAllocSize,
+                                                    VPU::VPUBufferObject::Type::CachedFw,
+                                                    VPU::VPUBufferObject::Location::Shared));
+    ASSERT_NE(nullptr, tsDest);
+
+    auto hNNCmdlist1 = createCommandList();
+    ASSERT_NE(nullptr, hNNCmdlist1);
+    auto nnCmdlist1 = L0::CommandList::fromHandle(hNNCmdlist1);
+    for (auto *cmdList : {nnCmdlist, nnCmdlist1}) {
+        ASSERT_EQ(ZE_RESULT_SUCCESS,
+                  cmdList->appendWriteGlobalTimestamp(tsDest, nullptr, 0, nullptr));
+        ASSERT_EQ(ZE_RESULT_SUCCESS, cmdList->close());
+    }
+
+    nnCmdque->enableCommandListFusion();
+    ze_command_list_handle_t nnCmdlists[] = {hNNCmdlist, hNNCmdlist1};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, nnCmdque->executeCommandLists(2, nnCmdlists, nullptr));
+    EXPECT_EQ(1u, osInfc.callCntSubmit);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, nnCmdque->synchronize(syncTimeout));
+
+    // Fused job is kept by the context cache only
+    std::weak_ptr<VPU::VPUJob> fusedJob = nnCmdlist1->getJob()->getFusedJob();
+    EXPECT_FALSE(fusedJob.expired());
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, nnCmdlist->reset());
+    EXPECT_TRUE(fusedJob.expired());
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, nnCmdlist1->destroy());
+    ASSERT_TRUE(ctx->freeMemAlloc(tsDest));
+}
+
 } // namespace ult
 } // namespace L0
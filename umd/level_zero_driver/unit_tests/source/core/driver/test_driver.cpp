@@ -5,6 +5,7 @@
  *
  */
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "gtest/gtest.h"
@@ -20,6 +21,8 @@
 #include <memory>
 #include <stdlib.h>
 #include <string.h>
+#include <string>
+#include <vector>
 
 namespace L0 {
 namespace ult {
@@ -142,5 +145,100 @@ TEST_F(DriverVersionTest, checkEnvironmentVariableInitialization) {
                            : setenv("ZE_INTEL_NPU_LOGLEVEL", umdLogLevel, 1);
 }
 
+TEST_F(DriverVersionTest, checkImmediateCommandListEnvironmentVariables) {
+    const char *names[] = {"ZE_INTEL_NPU_IMMEDIATE_INFLIGHT_MAX",
+                           "ZE_INTEL_NPU_IMMEDIATE_BATCH_SIZE",
+                           "ZE_INTEL_NPU_IMMEDIATE_BATCH_WINDOW_US"};
+    std::vector<std::string> defaults;
+    for (const char *name : names) {
+        const char *env = getenv(name);
+        defaults.push_back(env == nullptr ? "" : env);
+        unsetenv(name);
+    }
+
+    driver.initializeEnvVariables();
+    EXPECT_EQ(driver.getEnvVariables().immediateInFlightMax, 1u);
+    EXPECT_EQ(driver.getEnvVariables().immediateBatchSize, 1u);
+    EXPECT_EQ(driver.getEnvVariables().immediateBatchWindowUs, 100u);
+
+    setenv("ZE_INTEL_NPU_IMMEDIATE_INFLIGHT_MAX", "8", 1);
+    setenv("ZE_INTEL_NPU_IMMEDIATE_BATCH_SIZE", "16", 1);
+    // Invalid value keeps the default
+    setenv("ZE_INTEL_NPU_IMMEDIATE_BATCH_WINDOW_US", "abc", 1);
+
+    driver.initializeEnvVariables();
+    EXPECT_EQ(driver.getEnvVariables().immediateInFlightMax, 8u);
+    EXPECT_EQ(driver.getEnvVariables().immediateBatchSize, 16u);
+    EXPECT_EQ(driver.getEnvVariables().immediateBatchWindowUs, 100u);
+
+    for (size_t i = 0; i < defaults.size(); i++)
+        defaults[i].empty() ? unsetenv(names[i]) : setenv(names[i], defaults[i].c_str(), 1);
+    driver.initializeEnvVariables();
+}
+
+struct EnvVariableParam {
+    const char *name;
+    const char *value;
+    uint32_t expectedDefault;
+    uint32_t expectedValue;
+    uint32_t (*get)(const Driver::L0EnvVariables &env);
+};
+
+struct GraphEnvVariableTest : public DeviceFixture,
+                              public ::testing::TestWithParam<EnvVariableParam> {
+    void SetUp() override { DeviceFixture::SetUp(); }
+    void TearDown() override { DeviceFixture::TearDown(); }
+};
+
+INSTANTIATE_TEST_SUITE_P(,
+                         GraphEnvVariableTest,
+                         ::testing::ValuesIn(std::vector<EnvVariableParam>{
+                             {"ZE_INTEL_NPU_GRAPH_INSTANCES",
+                              "4",
+                              1u,
+                              4u,
+                              [](const Driver::L0EnvVariables &env) -> uint32_t {
+                                  return env.graphInstances;
+                              }},
+                             {"ZE_INTEL_NPU_SHARE_GRAPH_SECTIONS",
+                              "0",
+                              1u,
+                              0u,
+                              [](const Driver::L0EnvVariables &env) -> uint32_t {
+                                  return env.shareGraphSections;
+                              }},
+                             {"ZE_INTEL_NPU_GRAPH_LOAD_THREADS",
+                              "1",
+                              4u,
+                              1u,
+                              [](const Driver::L0EnvVariables &env) -> uint32_t {
+                                  return env.graphLoadThreads;
+                              }},
+                             {"ZE_INTEL_NPU_GRAPH_CREATE_THREADS",
+                              "2",
+                              4u,
+                              2u,
+                              [](const Driver::L0EnvVariables &env) -> uint32_t {
+                                  return env.graphCreateThreads;
+                              }},
+                         }));
+
+TEST_P(GraphEnvVariableTest, valueIsReadFromEnvironment) {
+    const auto &param = GetParam();
+    const char *env = getenv(param.name);
+    std::string envDefault = env == nullptr ? "" : env;
+
+    unsetenv(param.name);
+    driver.initializeEnvVariables();
+    EXPECT_EQ(param.get(driver.getEnvVariables()), param.expectedDefault);
+
+    setenv(param.name, param.value, 1);
+    driver.initializeEnvVariables();
+    EXPECT_EQ(param.get(driver.getEnvVariables()), param.expectedValue);
+
+    envDefault.empty() ? unsetenv(param.name) : setenv(param.name, envDefault.c_str(), 1);
+    driver.initializeEnvVariables();
+}
+
 } // namespace ult
 } // namespace L0
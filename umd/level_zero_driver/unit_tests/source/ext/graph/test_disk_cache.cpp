@@ -111,6 +111,11 @@ TEST_F(DiskCacheTest, HitCache) {
 
     EXPECT_CALL(*osFile, size).WillRepeatedly(::testing::Return(fileSize));
     EXPECT_CALL(*osFile, mmap).WillRepeatedly(::testing::Return(mmapPtr.get()));
+    EXPECT_CALL(*osFile, read)
+        .WillRepeatedly([&mmapPtr](void *out, size_t size, size_t offset) {
+            memcpy(out, mmapPtr.get() + offset, size);
+            return true;
+        });
 
     EXPECT_CALL(osInfc, osiOpenWithSharedLock).WillOnce(::testing::Return(std::move(osFile)));
 
@@ -120,6 +125,36 @@ TEST_F(DiskCacheTest, HitCache) {
     EXPECT_NE(blob, nullptr);
     EXPECT_EQ(blob->ptr, mmapPtr.get());
     EXPECT_EQ(blob->size, fileSize - HashSha1::DigestLength);
+    EXPECT_NE(blob->getFile(), nullptr);
+}
+
+TEST_F(DiskCacheTest, MissCacheInvalidChecksum) {
+    constexpr size_t fileSize = 64 + HashSha1::DigestLength;
+
+    auto osFile = std::make_unique<VPU::GMockOsFileImp>();
+    auto mmapPtr = std::make_unique<uint8_t[]>(fileSize);
+
+    EXPECT_CALL(*osFile, size).WillRepeatedly(::testing::Return(fileSize));
+    EXPECT_CALL(*osFile, mmap).WillRepeatedly(::testing::Return(mmapPtr.get()));
+    EXPECT_CALL(*osFile, read)
+        .WillRepeatedly([&mmapPtr](void *out, size_t size, size_t offset) {
+            memcpy(out, mmapPtr.get() + offset, size);
+            return true;
+        });
+
+    EXPECT_CALL(osInfc, osiOpenWithSharedLock).WillOnce(::testing::Return(std::move(osFile)));
+    EXPECT_CALL(osInfc, osiFileRemove).WillOnce(::testing::Return(true));
+
+    ze_graph_desc_2_t desc = {};
+    auto key = cache->computeKey(desc);
+    EXPECT_EQ(cache->getBlob(key), nullptr);
+}
+
+TEST_F(DiskCacheTest, RemoveBlob) {
+    EXPECT_CALL(osInfc, osiFileRemove).WillOnce(::testing::Return(true));
+
+    ze_graph_desc_2_t desc = {};
+    cache->removeBlob(cache->computeKey(desc));
 }
 
 class HashSha1Test : public testing::TestWithParam<std::pair<const char *, const char *>> {};
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "level_zero_driver/source/ext/blob_container.hpp"
+#include "level_zero_driver/source/ext/elf_parser.hpp"
+#include "level_zero_driver/unit_tests/fixtures/device_fixture.hpp"
+#include "level_zero_driver/unit_tests/options.hpp"
+#include "level_zero_driver/unit_tests/utils.hpp"
+#include "vpu_driver/unit_tests/test_macros/test.hpp"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+#include <vpux_elf/reader.hpp>
+#include <vpux_elf/types/section_header.hpp>
+#include <vpux_headers/buffer_specs.hpp>
+
+namespace L0 {
+namespace ult {
+
+struct ElfParserFixture : ContextFixture {
+    void SetUp() override {
+        ContextFixture::SetUp();
+
+        ASSERT_FALSE(TestOptions::blobPath.empty()) << "Blob path has not been provided";
+
+        loadBlobFromFile(TestOptions::blobPath, blob);
+        ASSERT_NE(0u, blob.size());
+        blobContainer = std::make_unique<BlobContainer>(blob.data(), blob.size());
+    }
+
+    void TearDown() override {
+        parser.reset();
+        ContextFixture::TearDown();
+    }
+
+    void createParser() {
+        std::string logBuffer;
+        parser = ElfParser::getElfParser(ctx, blobContainer, logBuffer);
+        ASSERT_NE(parser, nullptr) << logBuffer;
+    }
+
+    /**
+     * Read every section through the access manager of the parser, the way the loader does
+     * before it applies relocations
+     */
+    std::vector<std::vector<uint8_t>> readSections() {
+        auto &access = parser->getAccessManager();
+        elf::Reader<elf::ELF_Bitness::Elf64> reader(&access);
+
+        std::vector<std::vector<uint8_t>> sections;
+        for (size_t i = 0; i < reader.getSectionsNum(); i++) {
+            const auto *header = reader.getSectionNoData(i).getHeader();
+            if (header->sh_type == elf::SHT_NOBITS || header->sh_size == 0)
+                continue;
+
+            elf::BufferSpecs specs = {};
+            specs.alignment = header->sh_addralign;
+            specs.size = header->sh_size;
+            specs.procFlags = header->sh_flags;
+            auto buffer = access.readInternal(header->sh_offset, specs);
+            const uint8_t *data = buffer->getBuffer().cpu_addr();
+            sections.emplace_back(data, data + header->sh_size);
+        }
+        return sections;
+    }
+
+    std::vector<uint8_t> blob;
+    std::unique_ptr<BlobContainer> blobContainer;
+    std::unique_ptr<ElfParser> parser;
+};
+
+using ElfParserTest = Test<ElfParserFixture>;
+
+TEST_F(ElfParserTest, releasedHostParsedInferenceIsReusedByNextAcquire) {
+    createParser();
+    auto &manager = parser->getHostParsedInferenceManager();
+
+    auto hpi = manager.acquire();
+    ASSERT_NE(hpi, nullptr);
+    auto *released = hpi.get();
+    hpi.reset();
+
+    hpi = manager.acquire();
+    EXPECT_EQ(hpi.get(), released);
+    EXPECT_EQ(manager.size(), 1u);
+
+    // Instance in use is not handed out twice
+    auto second = manager.acquire();
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(second.get(), released);
+    EXPECT_EQ(manager.size(), 2u);
+}
+
+TEST_F(ElfParserTest, initializeCreatesConfiguredNumberOfHostParsedInferences) {
+    constexpr uint32_t instances = 3;
+    driver.setGraphInstances(instances);
+    createParser();
+    auto &manager = parser->getHostParsedInferenceManager();
+    EXPECT_EQ(manager.size(), 1u);
+
+    ASSERT_EQ(parser->initialize(), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(manager.size(), instances);
+
+    std::vector<std::shared_ptr<elf::HostParsedInference>> hpis;
+    std::set<elf::HostParsedInference *> unique;
+    for (size_t i = 0; i < instances; i++) {
+        hpis.push_back(manager.acquire());
+        ASSERT_NE(hpis.back(), nullptr);
+        unique.insert(hpis.back().get());
+    }
+    EXPECT_EQ(unique.size(), instances);
+    EXPECT_EQ(manager.size(), instances);
+
+    // All pre-created instances are in use, next one is created on demand
+    hpis.push_back(manager.acquire());
+    ASSERT_NE(hpis.back(), nullptr);
+    EXPECT_EQ(manager.size(), instances + 1);
+}
+
+TEST_F(ElfParserTest, parallelLoadReadsSameSectionContentAsSerialLoad) {
+    createParser();
+    auto serial = readSections();
+    ASSERT_FALSE(serial.empty());
+    parser.reset();
+
+    driver.setGraphLoadThreads(4);
+    driver.setGraphCreateThreads(3);
+    createParser();
+    auto parallel = readSections();
+
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (size_t i = 0; i < serial.size(); i++)
+        EXPECT_TRUE(serial[i] == parallel[i]) << "Section " << i << " differs";
+}
+
+} // namespace ult
+} // namespace L0
@@ -110,6 +110,45 @@ TEST_F(GraphNativeTest, whenCreatingGraphFromMalformedBufferInvalidArgumentIsRet
     EXPECT_TRUE(ctx->freeMemAlloc(data));
 }
 
+TEST_F(GraphNativeTest, whenCreatingGraphAsyncFromMalformedBufferGraphCallsReturnTheError) {
+    std::vector<uint8_t> data(4096u, 0xfe);
+    graphDesc.inputSize = data.size();
+    graphDesc.pInput = data.data();
+
+    ze_graph_handle_t hGraphNew = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS,
+              L0::Graph::createAsync(context, device, &graphDesc, nullptr, &hGraphNew));
+    ASSERT_NE(hGraphNew, nullptr);
+
+    auto *graphNew = L0::Graph::fromHandle(hGraphNew);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, graphNew->waitForCreation());
+
+    uint32_t size = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, graphNew->getCreateLog(&size, nullptr));
+    std::string log(size, '\0');
+    EXPECT_EQ(ZE_RESULT_SUCCESS, graphNew->getCreateLog(&size, log.data()));
+    EXPECT_NE(log.find("Failed to recognize native binary format"), std::string::npos);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, graphNew->destroy());
+}
+
+TEST_F(GraphNativeTest, whenCreatingGraphAsyncPropertiesMatchSynchronouslyCreatedGraph) {
+    ze_graph_handle_t hGraphNew = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS,
+              L0::Graph::createAsync(context, device, &graphDesc, nullptr, &hGraphNew));
+    ASSERT_NE(hGraphNew, nullptr);
+
+    auto *graphNew = L0::Graph::fromHandle(hGraphNew);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, graphNew->waitForCreation());
+
+    ze_graph_properties_t prop = {};
+    ze_graph_properties_t propNew = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, graph->getProperties(&prop));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, graphNew->getProperties(&propNew));
+    EXPECT_EQ(prop.numGraphArgs, propNew.numGraphArgs);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, graphNew->parserInitialize());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, graphNew->destroy());
+}
+
 TEST_F(GraphNativeTest, whenCallgetNativeBinaryWithoutSizePointerExpectInvalidNullPointerError) {
     EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, graph->getNativeBinary(nullptr, nullptr));
 }
@@ -15,7 +15,7 @@ VPUBarrierCommand::VPUBarrierCommand()
 
     cmd.header.type = VPU_CMD_BARRIER;
     cmd.header.size = sizeof(vpu_cmd_barrier_t);
-    command.emplace<vpu_cmd_barrier_t>(cmd);
+    command.barrier = cmd;
 };
 
 std::shared_ptr<VPUBarrierCommand> VPUBarrierCommand::create() {
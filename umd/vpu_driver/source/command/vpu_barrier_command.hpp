@@ -13,7 +13,6 @@
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "vpu_driver/source/command/vpu_command.hpp"
 
-#include <any>
 #include <memory>
 
 namespace VPU {
@@ -23,11 +22,6 @@ class VPUBarrierCommand : public VPUCommand {
     VPUBarrierCommand();
 
     static std::shared_ptr<VPUBarrierCommand> create();
-
-    const vpu_cmd_header_t *getHeader() const {
-        return reinterpret_cast<const vpu_cmd_header_t *>(
-            std::any_cast<const vpu_cmd_barrier_t>(&command));
-    }
 };
 
 } // namespace VPU
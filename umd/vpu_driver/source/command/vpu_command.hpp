@@ -13,7 +13,6 @@
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "vpu_driver/source/utilities/log.hpp"
 
-#include <any>
 #include <memory>
 #include <optional>
 #include <unordered_map>
@@ -32,6 +31,20 @@ struct VPUDescriptor {
     uint32_t numDescriptors = 0;
 };
 
+/**
+ * FW command stored inline in VPUCommand, every command starts with vpu_cmd_header_t
+ */
+union VPUCommandData {
+    vpu_cmd_header_t header;
+    vpu_cmd_copy_buffer_t copyBuffer;
+    vpu_cmd_memory_fill_t memoryFill;
+    vpu_cmd_inference_execute_t inferenceExecute;
+    vpu_cmd_timestamp_t timestamp;
+    vpu_cmd_fence_t fence;
+    vpu_cmd_barrier_t barrier;
+    vpu_cmd_metric_query_t metricQuery;
+};
+
 class VPUCommand {
   public:
     enum class ScheduleType {
@@ -103,9 +116,11 @@ class VPUCommand {
     void eraseAssociatedBufferObjects(size_t pos);
 
     void setDescriptor(VPUDescriptor &&d) { descriptor = std::move(d); }
-    virtual const vpu_cmd_header_t *getHeader() const { return nullptr; }
+    const vpu_cmd_header_t *getHeader() const {
+        return command.header.size != 0 ? &command.header : nullptr;
+    }
 
-    std::any command = {};
+    VPUCommandData command = {};
 
     bool cmdNeedsUpdate = false;
 
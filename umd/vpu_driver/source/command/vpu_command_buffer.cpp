@@ -21,6 +21,27 @@
 
 namespace VPU {
 
+static std::shared_ptr<VPUBufferObject>
+takeSpareBuffer(std::vector<std::shared_ptr<VPUBufferObject>> *spareBuffers, size_t size) {
+    if (spareBuffers == nullptr)
+        return nullptr;
+
+    auto best = spareBuffers->end();
+    for (auto it = spareBuffers->begin(); it != spareBuffers->end(); it++) {
+        if ((*it)->getAllocSize() < size)
+            continue;
+        if (best == spareBuffers->end() || (*it)->getAllocSize() < (*best)->getAllocSize())
+            best = it;
+    }
+
+    if (best == spareBuffers->end())
+        return nullptr;
+
+    auto bo = std::move(*best);
+    spareBuffers->erase(best);
+    return bo;
+}
+
 VPUCommandBuffer::VPUCommandBuffer(VPUDeviceContext *ctx,
                                    std::shared_ptr<VPUBufferObject> buffer,
                                    const std::vector<std::shared_ptr<VPUCommand>>::iterator &begin,
@@ -30,7 +51,7 @@ VPUCommandBuffer::VPUCommandBuffer(VPUDeviceContext *ctx,
     , jobStatus(std::numeric_limits<uint32_t>::max())
     , commandsBegin(begin)
     , commandsEnd(end) {
-    bufferHandles.emplace_back(VPUCommandBuffer::buffer->getHandle());
+    addUniqueBoHandle(VPUCommandBuffer::buffer->getHandle());
 }
 
 std::unique_ptr<VPUCommandBuffer> VPUCommandBuffer::allocateCommandBuffer(
@@ -38,7 +59,8 @@ std::unique_ptr<VPUCommandBuffer> VPUCommandBuffer::allocateCommandBuffer(
     const std::vector<std::shared_ptr<VPUCommand>>::iterator &begin,
     const std::vector<std::shared_ptr<VPUCommand>>::iterator &end,
     VPUEventCommand::KMDEventDataType **fenceWait,
-    std::shared_ptr<VPUBufferObject> &fenceBo) {
+    std::shared_ptr<VPUBufferObject> &fenceBo,
+    std::vector<std::shared_ptr<VPUBufferObject>> *spareBuffers) {
     if (ctx == nullptr || begin == end) {
         LOG_E("VPUDeviceContext is nullptr or command list is empty");
         return nullptr;
@@ -62,11 +84,20 @@ std::unique_ptr<VPUCommandBuffer> VPUCommandBuffer::allocateCommandBuffer(
         cmdSize += sizeof(vpu_cmd_fence_t);
     }
 
+    // Add timeline fence signal command
+    cmdSize += sizeof(vpu_cmd_fence_t);
+
     size_t cmdBufferSize = sizeof(CommandHeader) + getFwDataCacheAlign(cmdSize) + descriptorSize +
                            ctx->getExtraDmaDescriptorSize();
 
-    std::shared_ptr<VPUBufferObject> buffer =
-        ctx->createUntrackedBufferObject(cmdBufferSize, VPUBufferObject::Type::CachedFw);
+    // New untracked buffer object is always zeroed, reused one has to be cleared up to the size
+    // used by this command buffer
+    size_t clearSize = cmdBufferSize;
+    std::shared_ptr<VPUBufferObject> buffer = takeSpareBuffer(spareBuffers, cmdBufferSize);
+    if (buffer == nullptr) {
+        buffer = ctx->createUntrackedBufferObject(cmdBufferSize, VPUBufferObject::Type::CachedFw);
+        clearSize = 0;
+    }
 
     if (buffer == nullptr) {
         LOG_E("Failed to allocate buffer object for command buffer");
@@ -74,7 +105,7 @@ std::unique_ptr<VPUCommandBuffer> VPUCommandBuffer::allocateCommandBuffer(
     }
 
     auto cmdBuffer = std::make_unique<VPUCommandBuffer>(ctx, buffer, begin, end);
-    if (!cmdBuffer->initHeader(cmdSize)) {
+    if (!cmdBuffer->initHeader(cmdSize, clearSize)) {
         LOG_E("Failed to initialize VPUCommandBuffer");
         return nullptr;
     }
@@ -97,7 +128,7 @@ std::unique_ptr<VPUCommandBuffer> VPUCommandBuffer::allocateCommandBuffer(
 
     for (auto it = begin; it != end; it++) {
         const auto &cmd = *it;
-        if (cmd->isSynchronizeCommand() && !cmdBuffer->setSyncFenceAddr(cmd.get())) {
+        if (cmd->isSynchronizeCommand() && !cmdBuffer->addSyncFenceAddr(cmd.get())) {
             LOG_E("Failed to set synchronize fence vpu addresss");
             return nullptr;
         }
@@ -123,7 +154,22 @@ std::unique_ptr<VPUCommandBuffer> VPUCommandBuffer::allocateCommandBuffer(
         }
 
         *fenceWait = fenceSignal;
-        fenceBo = std::move(buffer);
+        fenceBo = buffer;
+    }
+
+    // VPUDeviceQueue points the signal to the queue timeline fence at submission
+    VPUEventCommand::KMDEventDataType *timelineSignal = reinterpret_cast<uint64_t *>(
+        buffer->getBasePointer() + offsetof(CommandHeader, timelineValue));
+    auto timelineCmd = VPUEventSignalCommand::create(timelineSignal, buffer);
+    if (timelineCmd == nullptr) {
+        LOG_E("Failed to create timeline signal command");
+        return nullptr;
+    }
+
+    cmdBuffer->timelineSignalOffset = cmdOffset;
+    if (!cmdBuffer->addCommand(timelineCmd.get(), cmdOffset, descOffset)) {
+        LOG_E("Failed to append timeline signal command to buffer");
+        return nullptr;
     }
 
     if (cmdOffset != offsetof(CommandHeader, commandList) + cmdSize) {
@@ -141,7 +187,7 @@ std::unique_ptr<VPUCommandBuffer> VPUCommandBuffer::allocateCommandBuffer(
     return cmdBuffer;
 }
 
-bool VPUCommandBuffer::initHeader(size_t cmdSize) {
+bool VPUCommandBuffer::initHeader(size_t cmdSize, size_t clearSize) {
     if (buffer == nullptr) {
         LOG_E("Invalid command buffer pointer is passed");
         return false;
@@ -151,7 +197,7 @@ bool VPUCommandBuffer::initHeader(size_t cmdSize) {
         reinterpret_cast<vpu_cmd_buffer_header_t *>(buffer->getBasePointer());
 
     // Init memory - required for backward/forward compatibility with the firmware
-    memset(buffer->getBasePointer(), 0, buffer->getAllocSize());
+    memset(buffer->getBasePointer(), 0, clearSize);
 
     bb->cmd_offset = offsetof(CommandHeader, commandList);
     bb->cmd_buffer_size = safe_cast<uint32_t>(bb->cmd_offset + cmdSize);
@@ -161,8 +207,20 @@ bool VPUCommandBuffer::initHeader(size_t cmdSize) {
 }
 
 void VPUCommandBuffer::addUniqueBoHandle(uint32_t handle) {
-    auto it = std::find(bufferHandles.begin(), bufferHandles.end(), handle);
-    if (it == bufferHandles.end())
+    if (bufferHandles.size() < handleScanLimit) {
+        if (std::find(bufferHandles.begin(), bufferHandles.end(), handle) == bufferHandles.end())
+            bufferHandles.emplace_back(handle);
+        return;
+    }
+
+    // Set is built once the handles outgrow the linear scan and kept in sync afterwards
+    if (bufferHandleSet.size() == 0) {
+        bufferHandleSet.reserve(bufferHandles.size() * 2);
+        for (auto bufferHandle : bufferHandles)
+            bufferHandleSet.insert(bufferHandle);
+    }
+
+    if (bufferHandleSet.insert(handle))
         bufferHandles.emplace_back(handle);
 }
 
@@ -205,22 +263,50 @@ bool VPUCommandBuffer::addCommand(VPUCommand *cmd, uint64_t &cmdOffset, uint64_t
     return true;
 }
 
-bool VPUCommandBuffer::setSyncFenceAddr(VPUCommand *cmd) {
-    if (syncFenceVpuAddr != 0) {
-        LOG_E("Synchronize Fence VPU Address is already set");
-        return false;
-    }
-
+bool VPUCommandBuffer::addSyncFenceAddr(VPUCommand *cmd) {
     if (cmd->getCommandType() != VPU_CMD_FENCE_SIGNAL) {
         LOG_E("Not supported command type for synchronize command");
         return false;
     }
 
     auto *fenceSignalHeader = reinterpret_cast<const vpu_cmd_fence_t *>(cmd->getCommitStream());
-    syncFenceVpuAddr = fenceSignalHeader->offset;
+    syncFenceVpuAddrs.push_back(fenceSignalHeader->offset);
     return true;
 }
 
+void VPUCommandBuffer::setTimelineSignal(uint64_t fenceVpuAddr,
+                                         uint64_t value,
+                                         uint32_t fenceHandle) {
+    auto *cmd =
+        reinterpret_cast<vpu_cmd_fence_t *>(buffer->getBasePointer() + timelineSignalOffset);
+    cmd->value = value;
+    cmd->offset = fenceVpuAddr;
+
+    // Handle is not added to the handle set, it is removed again after the submission
+    bool found = bufferHandleSet.size() != 0
+                     ? bufferHandleSet.contains(fenceHandle)
+                     : std::find(bufferHandles.begin(), bufferHandles.end(), fenceHandle) !=
+                           bufferHandles.end();
+    if (!found && !timelineHandleAdded) {
+        bufferHandles.emplace_back(fenceHandle);
+        timelineHandleAdded = true;
+    }
+}
+
+void VPUCommandBuffer::releaseTimelineHandle() {
+    if (!timelineHandleAdded)
+        return;
+
+    bufferHandles.pop_back();
+    timelineHandleAdded = false;
+}
+
+void VPUCommandBuffer::clearTimelineSignal() {
+    auto *cmd =
+        reinterpret_cast<vpu_cmd_fence_t *>(buffer->getBasePointer() + timelineSignalOffset);
+    cmd->offset = buffer->getVPUAddr() + offsetof(CommandHeader, timelineValue);
+}
+
 bool VPUCommandBuffer::waitForCompletion(int64_t timeout_abs_ns) {
     drm_ivpu_bo_wait args = {};
     args.handle = buffer->getHandle();
@@ -354,14 +440,30 @@ void VPUCommandBuffer::printCommandBuffer() const {
 
 bool VPUCommandBuffer::replaceBufferHandles(std::vector<uint32_t> &oldHandles,
                                             std::vector<uint32_t> &newHandles) {
-    bufferHandles.erase(std::remove_if(bufferHandles.begin(),
-                                       bufferHandles.end(),
-                                       [&oldHandles](auto x) {
-                                           return std::find(oldHandles.begin(),
-                                                            oldHandles.end(),
-                                                            x) != oldHandles.end();
-                                       }),
-                        bufferHandles.end());
+    if (oldHandles.size() < handleScanLimit) {
+        bufferHandles.erase(std::remove_if(bufferHandles.begin(),
+                                           bufferHandles.end(),
+                                           [&oldHandles](auto x) {
+                                               return std::find(oldHandles.begin(),
+                                                                oldHandles.end(),
+                                                                x) != oldHandles.end();
+                                           }),
+                            bufferHandles.end());
+    } else {
+        VPUHandleSet removed;
+        removed.reserve(oldHandles.size());
+        for (auto handle : oldHandles)
+            removed.insert(handle);
+
+        bufferHandles.erase(std::remove_if(bufferHandles.begin(),
+                                           bufferHandles.end(),
+                                           [&removed](auto x) { return removed.contains(x); }),
+                            bufferHandles.end());
+    }
+
+    // Rebuilt by addUniqueBoHandle if the handles still outgrow the linear scan
+    bufferHandleSet.clear();
+
     for (auto &handle : newHandles) {
         addUniqueBoHandle(handle);
     }
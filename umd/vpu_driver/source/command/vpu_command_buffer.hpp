@@ -12,8 +12,10 @@
 
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "vpu_driver/source/command/vpu_event_command.hpp"
+#include "vpu_driver/source/command/vpu_handle_set.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <uapi/drm/ivpu_accel.h>
 #include <vector>
@@ -36,6 +38,8 @@ class VPUCommandBuffer {
      * @param begin[in]: VPUCommands end iterator
      * @param fenceWait[in]: Wait fence for this Command Buffer or nullptr
      * @param fenceBo[in]: Buffer object associated with fenceWait or nullptr
+     * @param spareBuffers[in]: Buffers of previous recording, the smallest one that fits is taken
+     * instead of allocating new buffer object
      * @return unique_ptr<VPUCommandBuffer> for success, nullptr for any allocation failures
      */
     static std::unique_ptr<VPUCommandBuffer>
@@ -43,7 +47,8 @@ class VPUCommandBuffer {
                           const std::vector<std::shared_ptr<VPUCommand>>::iterator &begin,
                           const std::vector<std::shared_ptr<VPUCommand>>::iterator &end,
                           VPUEventCommand::KMDEventDataType **fenceWait,
-                          std::shared_ptr<VPUBufferObject> &fenceBo);
+                          std::shared_ptr<VPUBufferObject> &fenceBo,
+                          std::vector<std::shared_ptr<VPUBufferObject>> *spareBuffers = nullptr);
 
     /**
      * Return true if job is finished
@@ -57,6 +62,11 @@ class VPUCommandBuffer {
 
     uint64_t getResult() const { return jobStatus; }
 
+    /**
+     * Record success of the command buffer observed without kernel driver
+     */
+    void setSuccess() { jobStatus = DRM_IVPU_JOB_STATUS_SUCCESS; }
+
     /**
      * Return the vector of stored buffer handles
      */
@@ -73,9 +83,37 @@ class VPUCommandBuffer {
     const uint8_t *getBufferPtr() const { return buffer->getBasePointer(); }
 
     /**
-     * Return the VPU address of fence signal command
+     * Return buffer object that stores the command buffer
+     */
+    const std::shared_ptr<VPUBufferObject> &getBuffer() const { return buffer; }
+
+    /**
+     * Return true if the command buffer signals fence at given VPU address
+     */
+    bool hasFenceAddr(uint64_t vpuAddr) const {
+        return std::find(syncFenceVpuAddrs.begin(), syncFenceVpuAddrs.end(), vpuAddr) !=
+               syncFenceVpuAddrs.end();
+    }
+
+    /**
+     * Point the signal command at the end of the command buffer to the timeline fence
+     * @param fenceVpuAddr[in]: VPU address of the timeline fence
+     * @param value[in]: Value written by the device when the command buffer completes
+     * @param fenceHandle[in]: Handle of buffer object that stores the timeline fence, passed to
+     * kernel driver until releaseTimelineHandle is called
+     */
+    void setTimelineSignal(uint64_t fenceVpuAddr, uint64_t value, uint32_t fenceHandle);
+
+    /**
+     * Remove the timeline fence handle added by setTimelineSignal, called once the command buffer
+     * is submitted
+     */
+    void releaseTimelineHandle();
+
+    /**
+     * Point the signal command at the end of the command buffer back to the command header
      */
-    uint64_t getFenceAddr() const { return syncFenceVpuAddr; }
+    void clearTimelineSignal();
 
     bool replaceBufferHandles(std::vector<uint32_t> &oldHandles, std::vector<uint32_t> &newHandles);
 
@@ -84,8 +122,9 @@ class VPUCommandBuffer {
   private:
     /**
      * Initialize command buffer header
+     * @param clearSize[in]: Size of region cleared before use, 0 for freshly allocated buffer
      */
-    bool initHeader(size_t cmdSize);
+    bool initHeader(size_t cmdSize, size_t clearSize);
 
     /**
      * Add VPUCommand details to the command list
@@ -93,9 +132,9 @@ class VPUCommandBuffer {
     bool addCommand(VPUCommand *cmd, uint64_t &cmdOffset, uint64_t &descOffset);
 
     /**
-     * Set fence address that is used for command buffer recognition
+     * Add fence address that is used for command buffer recognition
      */
-    bool setSyncFenceAddr(VPUCommand *cmd);
+    bool addSyncFenceAddr(VPUCommand *cmd);
     void addUniqueBoHandle(uint32_t handle);
 
   public:
@@ -104,7 +143,9 @@ class VPUCommandBuffer {
         vpu_cmd_buffer_header header;
         uint8_t contextSaveArea[VPU_CONTEXT_SAVE_AREA_SIZE] __attribute__((aligned(64)));
         VPUEventCommand::KMDEventDataType fenceValue;
-        uint64_t reserved_1[7];
+        // Written by the timeline signal command when it is not pointed to the timeline fence
+        VPUEventCommand::KMDEventDataType timelineValue;
+        uint64_t reserved_1[6];
         uint8_t commandList[0];
         uint8_t descriptorList[0];
     };
@@ -128,8 +169,14 @@ class VPUCommandBuffer {
     std::vector<std::shared_ptr<VPUCommand>>::iterator commandsBegin;
     std::vector<std::shared_ptr<VPUCommand>>::iterator commandsEnd;
 
-    uint64_t syncFenceVpuAddr = 0;
+    std::vector<uint64_t> syncFenceVpuAddrs;
+    uint64_t timelineSignalOffset = 0;
+    // Timeline fence handle is appended to bufferHandles for a single submission
+    bool timelineHandleAdded = false;
+    // Few handles are searched linearly, the set mirrors bufferHandles only above the limit
+    static constexpr size_t handleScanLimit = 16;
     std::vector<uint32_t> bufferHandles;
+    VPUHandleSet bufferHandleSet;
 };
 
 } // namespace VPU
@@ -56,9 +56,9 @@ VPUCopyCommand::VPUCopyCommand(const std::shared_ptr<VPUBufferObject> srcBo,
     cmd.header.size = sizeof(vpu_cmd_copy_buffer_t);
     cmd.desc_start_offset = 0u;
     cmd.desc_count = descriptor.numDescriptors;
-    command.emplace<vpu_cmd_copy_buffer_t>(cmd);
+    command.copyBuffer = cmd;
 
-    descriptor.commandOffset = &(std::any_cast<vpu_cmd_copy_buffer_t>(&command)->desc_start_offset);
+    descriptor.commandOffset = &command.copyBuffer.desc_start_offset;
 
     setDescriptor(std::move(descriptor));
     appendAssociateBufferObject(std::move(srcBo));
@@ -15,7 +15,6 @@
 #include "vpu_driver/source/command/vpu_command.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
-#include <any>
 #include <memory>
 #include <vector>
 
@@ -37,11 +36,6 @@ class VPUCopyCommand : public VPUCommand {
                                                   std::shared_ptr<VPUBufferObject> dstBo,
                                                   size_t size);
 
-    const vpu_cmd_header_t *getHeader() const {
-        return reinterpret_cast<const vpu_cmd_header_t *>(
-            std::any_cast<vpu_cmd_copy_buffer_t>(&command));
-    }
-
     template <class T>
     static bool
     fillDescriptor(uint64_t srcAddr, uint64_t dstAddr, size_t size, VPUDescriptor &descriptor) {
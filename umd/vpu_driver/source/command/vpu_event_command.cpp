@@ -45,7 +45,7 @@ VPUEventCommand::VPUEventCommand(const ScheduleType schType,
     cmd.header.size = sizeof(vpu_cmd_fence_t);
     cmd.value = eventState;
     cmd.offset = eventHeapBo->getVPUAddr(eventHeapPtr);
-    command.emplace<vpu_cmd_fence_t>(cmd);
+    command.fence = cmd;
     appendAssociateBufferObject(std::move(eventHeapBo));
 }
 
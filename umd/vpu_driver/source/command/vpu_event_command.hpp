@@ -12,7 +12,6 @@
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "vpu_driver/source/command/vpu_command.hpp"
 
-#include <any>
 #include <memory>
 #include <utility>
 
@@ -49,10 +48,6 @@ class VPUEventCommand : public VPUCommand {
                     std::shared_ptr<VPUBufferObject> eventHeapBo,
                     const KMDEventDataType eventState);
 
-    const vpu_cmd_header_t *getHeader() const {
-        return reinterpret_cast<const vpu_cmd_header_t *>(std::any_cast<vpu_cmd_fence_t>(&command));
-    }
-
   private:
     static const char *getEventCommandStr(const vpu_cmd_type cmdType,
                                           const KMDEventDataType eventState);
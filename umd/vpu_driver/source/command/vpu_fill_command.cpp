@@ -46,7 +46,7 @@ VPUFillCommand::VPUFillCommand(void *dstPtr,
     cmd.start_address = dstBo->getVPUAddr(dstPtr);
     cmd.size = size;
     cmd.fill_pattern = fill_pattern;
-    command.emplace<vpu_cmd_memory_fill_t>(cmd);
+    command.memoryFill = cmd;
     appendAssociateBufferObject(std::move(dstBo));
     LOG(VPU_CMD, "Fill Command successfully created!");
 }
@@ -11,7 +11,6 @@
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "vpu_driver/source/command/vpu_command.hpp"
 
-#include <any>
 #include <memory>
 
 namespace VPU {
@@ -28,10 +27,6 @@ class VPUFillCommand : public VPUCommand {
                                                   std::shared_ptr<VPUBufferObject> dstBo,
                                                   uint64_t size,
                                                   uint32_t fill_pattern);
-    const vpu_cmd_header_t *getHeader() const {
-        return reinterpret_cast<const vpu_cmd_header_t *>(
-            std::any_cast<vpu_cmd_memory_fill_t>(&command));
-    }
 };
 
 } // namespace VPU
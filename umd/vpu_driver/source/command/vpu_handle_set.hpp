@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace VPU {
+
+/**
+ * Set of buffer object handles.
+ *
+ * Open addressing table with linear probing. Table slots keep handle + 1, zero marks an empty
+ * slot. Table grows twice when it is half full. A linear scan of a vector is faster for a few
+ * handles, the set is meant for larger ones.
+ */
+class VPUHandleSet {
+  public:
+    /**
+     * Insert handle into the set
+     * @return true if handle was not present in the set
+     */
+    bool insert(uint32_t handle) {
+        if (slots.empty())
+            rehash(initialSlots);
+        else if ((count + 1) * 2 > slots.size())
+            rehash(slots.size() * 2);
+        return insertSlot(handle);
+    }
+
+    bool contains(uint32_t handle) const {
+        if (slots.empty())
+            return false;
+
+        size_t mask = slots.size() - 1;
+        uint64_t key = static_cast<uint64_t>(handle) + 1;
+        for (size_t i = hash(handle) & mask; slots[i] != 0; i = (i + 1) & mask) {
+            if (slots[i] == key)
+                return true;
+        }
+        return false;
+    }
+
+    void reserve(size_t handleCount) {
+        size_t slotCount = initialSlots;
+        while (slotCount < handleCount * 2)
+            slotCount *= 2;
+        if (slotCount > slots.size())
+            rehash(slotCount);
+    }
+
+    void clear() {
+        if (!slots.empty())
+            slots.assign(slots.size(), 0);
+        count = 0;
+    }
+
+    size_t size() const { return count; }
+
+  private:
+    static size_t hash(uint32_t handle) {
+        // Fibonacci hashing spreads sequential GEM handles over the table
+        return static_cast<size_t>((static_cast<uint64_t>(handle) * 0x9e3779b97f4a7c15ull) >> 32);
+    }
+
+    bool insertSlot(uint32_t handle) {
+        size_t mask = slots.size() - 1;
+        uint64_t key = static_cast<uint64_t>(handle) + 1;
+        for (size_t i = hash(handle) & mask;; i = (i + 1) & mask) {
+            if (slots[i] == key)
+                return false;
+            if (slots[i] == 0) {
+                slots[i] = key;
+                count++;
+                return true;
+            }
+        }
+    }
+
+    void rehash(size_t slotCount) {
+        std::vector<uint64_t> old = std::move(slots);
+        slots.assign(slotCount, 0);
+        count = 0;
+        for (uint64_t key : old) {
+            if (key != 0)
+                insertSlot(static_cast<uint32_t>(key - 1));
+        }
+    }
+
+    static constexpr size_t initialSlots = 64;
+
+    std::vector<uint64_t> slots;
+    size_t count = 0;
+};
+
+} // namespace VPU
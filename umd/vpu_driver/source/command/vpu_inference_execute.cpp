@@ -39,7 +39,7 @@ VPUInferenceExecute::VPUInferenceExecute(std::shared_ptr<L0::ElfParser> &parser,
     cmd.inference_id = inferenceId;
     cmd.host_mapped_inference.address = bos[0]->getVPUAddr();
     cmd.host_mapped_inference.width = safe_cast<uint32_t>(bos[0]->getAllocSize());
-    command.emplace<vpu_cmd_inference_execute_t>(cmd);
+    command.inferenceExecute = cmd;
 
     appendAssociateBufferObject(bos);
 
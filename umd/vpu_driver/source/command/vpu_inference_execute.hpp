@@ -12,7 +12,6 @@
 
 #include "vpu_driver/source/command/vpu_command.hpp"
 
-#include <any>
 #include <api/vpu_jsm_job_cmd_api.h>
 #include <memory>
 #include <vector>
@@ -55,11 +54,6 @@ class VPUInferenceExecute : public VPUCommand {
            uint64_t inferenceId,
            std::vector<std::shared_ptr<VPUBufferObject>> &bos);
 
-    const vpu_cmd_header_t *getHeader() const override {
-        return reinterpret_cast<const vpu_cmd_header_t *>(
-            std::any_cast<vpu_cmd_inference_execute_t>(&command));
-    }
-
     bool setUpdates(const ArgumentUpdatesMap &updatesMap) override;
     bool update(VPUCommandBuffer *commandBuffer) override;
 
@@ -10,8 +10,11 @@
 #include "umd_common.hpp"
 #include "vpu_driver/source/command/vpu_event_command.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
+#include "vpu_driver/source/utilities/spin_wait.hpp"
 
+#include <chrono>
 #include <iterator>
+#include <limits>
 #include <uapi/drm/ivpu_accel.h>
 #include <utility>
 
@@ -19,8 +22,45 @@ namespace VPU {
 class VPUBufferObject;
 class VPUDeviceContext;
 
-VPUJob::VPUJob(VPUDeviceContext *ctx)
-    : ctx(ctx) {}
+// Completion of job that is not signaled by the timeline fence is checked by kernel driver at
+// most once per interval, device does not signal the timeline for aborted job
+static constexpr std::chrono::milliseconds timelineProbeInterval(1);
+
+VPUJob::VPUJob(VPUDeviceContext *ctx, std::vector<std::shared_ptr<VPUBufferObject>> spareBuffers)
+    : ctx(ctx)
+    , spareBuffers(std::move(spareBuffers)) {}
+
+std::shared_ptr<VPUJob> VPUJob::createFused(VPUDeviceContext *ctx,
+                                            const std::vector<std::shared_ptr<VPUJob>> &jobs) {
+    auto fused = std::make_shared<VPUJob>(ctx);
+
+    size_t numCommands = 0;
+    for (const auto &job : jobs)
+        numCommands += job->getNumCommands();
+    fused->commands.reserve(numCommands);
+
+    for (const auto &job : jobs) {
+        // Commands are recorded again, arguments of mutable commands might have changed
+        for (const auto &cmd : job->getCommands()) {
+            if (!fused->appendCommand(cmd)) {
+                LOG_E("Failed to append command to fused job");
+                return nullptr;
+            }
+        }
+    }
+
+    if (!fused->closeCommands()) {
+        LOG_E("Failed to close fused job");
+        return nullptr;
+    }
+
+    LOG(VPU_JOB,
+        "Fused %zu jobs into job %p with %zu command buffers",
+        jobs.size(),
+        fused.get(),
+        fused->getCommandBuffers().size());
+    return fused;
+}
 
 bool VPUJob::closeCommands() {
     if (ctx == nullptr) {
@@ -51,29 +91,25 @@ bool VPUJob::closeCommands() {
 
     LOG(VPU_JOB, "Schedule commands, number of commands %lu", commands.size());
 
-    VPUEventCommand::KMDEventDataType *lastEvent = nullptr;
-    std::shared_ptr<VPUBufferObject> lastEventBo;
-    for (auto it = commands.begin(); it != commands.end();) {
-        auto next = scheduleCommands(it);
-
-        long jump = std::distance(it, next);
-        LOG(VPU_JOB, "Passing %lu commands to command buffer", jump);
-
-        if (safe_cast<size_t>(jump) == commands.size()) {
-            if (!createCommandBuffer(commands.begin(), commands.end(), nullptr, lastEventBo)) {
-                LOG_E("Failed to initialize command buffer");
-                return false;
-            }
-        } else {
-            if (!createCommandBuffer(it, next, &lastEvent, lastEventBo)) {
-                LOG_E("Failed to initialize command buffer");
-                return false;
-            }
-        }
+    // Signal events stay inline, host polls the event memory instead of waiting for a command
+    // buffer that ends at the event. Ordered job chains its buffer with the internal fences.
+    VPUEventCommand::KMDEventDataType *lastEvent = orderingFence;
+    std::shared_ptr<VPUBufferObject> lastEventBo = orderingFenceBo;
+    if (!commands.empty() && !createCommandBuffer(commands.begin(),
+                                                  commands.end(),
+                                                  ordered ? &lastEvent : nullptr,
+                                                  lastEventBo)) {
+        LOG_E("Failed to initialize command buffer");
+        return false;
+    }
 
-        it = next;
+    if (ordered) {
+        completionFence = lastEvent;
+        completionFenceBo = std::move(lastEventBo);
     }
 
+    // Buffers that did not fit are returned to the buffer cache
+    spareBuffers.clear();
     closed = true;
     return true;
 }
@@ -82,8 +118,12 @@ bool VPUJob::createCommandBuffer(const std::vector<std::shared_ptr<VPUCommand>>:
                                  const std::vector<std::shared_ptr<VPUCommand>>::iterator &end,
                                  VPUEventCommand::KMDEventDataType **lastEvent,
                                  std::shared_ptr<VPUBufferObject> &lastEventBo) {
-    auto cmdBuffer =
-        VPUCommandBuffer::allocateCommandBuffer(ctx, begin, end, lastEvent, lastEventBo);
+    auto cmdBuffer = VPUCommandBuffer::allocateCommandBuffer(ctx,
+                                                             begin,
+                                                             end,
+                                                             lastEvent,
+                                                             lastEventBo,
+                                                             &spareBuffers);
     if (cmdBuffer == nullptr) {
         LOG_E("Failed to allocate VPUCommandBuffer");
         return false;
@@ -93,7 +133,165 @@ bool VPUJob::createCommandBuffer(const std::vector<std::shared_ptr<VPUCommand>>:
     return true;
 }
 
+std::vector<std::shared_ptr<VPUBufferObject>> VPUJob::takeCommandBufferStorage() {
+    std::vector<std::shared_ptr<VPUBufferObject>> buffers;
+    buffers.reserve(cmdBuffers.size());
+    for (const auto &cmdBuffer : cmdBuffers) {
+        // Buffer object referenced outside of the job might still be read by the device
+        if (cmdBuffer->getBuffer().use_count() == 1)
+            buffers.push_back(cmdBuffer->getBuffer());
+    }
+    cmdBuffers.clear();
+    return buffers;
+}
+
+void VPUJob::setOrderingFence(VPUEventCommand::KMDEventDataType *fence,
+                              std::shared_ptr<VPUBufferObject> fenceBo) {
+    ordered = true;
+    orderingFence = fence;
+    orderingFenceBo = std::move(fenceBo);
+}
+
+void VPUJob::setPrecedingJob(std::shared_ptr<VPUJob> job) {
+    if (job == nullptr) {
+        setOrderingFence(nullptr, nullptr);
+        return;
+    }
+
+    setOrderingFence(job->getCompletionFence(), job->getCompletionFenceBo());
+    precedingJob = std::move(job);
+}
+
+bool VPUJob::setTimelineSignal(std::shared_ptr<VPUBufferObject> fenceBo,
+                               VPUEventCommand::KMDEventDataType *fence,
+                               uint64_t value) {
+    if (cmdBuffers.empty())
+        return false;
+
+    // Completion of the last command buffer implies completion of the preceding ones
+    const auto &cmdBuffer = cmdBuffers.back();
+    bool inFlight = isTimelineTracked() ? !isTimelineSignaled()
+                                        : untrackedSubmit && !cmdBuffer->waitForCompletion(0);
+    if (inFlight) {
+        // Device might read the signal command of previous submission at any moment. Timeline
+        // value written too early would complete the jobs submitted in between.
+        LOG(VPU_JOB, "Job %p is in flight, submission is not tracked by timeline fence", this);
+        cmdBuffer->clearTimelineSignal();
+        clearTimelineSignal();
+        untrackedSubmit = true;
+        return false;
+    }
+
+    cmdBuffer->setTimelineSignal(fenceBo->getVPUAddr(fence), value, fenceBo->getHandle());
+    const std::lock_guard<std::mutex> lock(timelineMutex);
+    timelineFenceBo = std::move(fenceBo);
+    timelineFence = fence;
+    timelineValue = value;
+    untrackedSubmit = false;
+    lastTimelineProbe = 0;
+    return true;
+}
+
+void VPUJob::clearTimelineSignal() {
+    const std::lock_guard<std::mutex> lock(timelineMutex);
+    timelineFenceBo.reset();
+    timelineFence = nullptr;
+    timelineValue = 0;
+}
+
+bool VPUJob::isTimelineTracked() {
+    const std::lock_guard<std::mutex> lock(timelineMutex);
+    return timelineFence != nullptr;
+}
+
+bool VPUJob::isTimelineSignaled() {
+    const std::lock_guard<std::mutex> lock(timelineMutex);
+    return timelineFence != nullptr &&
+           *static_cast<volatile VPUEventCommand::KMDEventDataType *>(timelineFence) >=
+               timelineValue;
+}
+
+VPUEventCommand::KMDEventDataType *VPUJob::getTimelineFence() {
+    const std::lock_guard<std::mutex> lock(timelineMutex);
+    return timelineFence;
+}
+
+uint64_t VPUJob::getTimelineValue() {
+    const std::lock_guard<std::mutex> lock(timelineMutex);
+    return timelineValue;
+}
+
+void VPUJob::setSubmitPending() {
+    const std::lock_guard<std::mutex> lock(submitMutex);
+    pendingSubmits++;
+    submitFailed = false;
+}
+
+void VPUJob::setSubmitDone(bool success, int error) {
+    {
+        const std::lock_guard<std::mutex> lock(submitMutex);
+        pendingSubmits--;
+        if (!success) {
+            submitError = error;
+            submitFailed = true;
+        }
+    }
+    submitCondition.notify_all();
+}
+
+bool VPUJob::waitForSubmit(int64_t timeout_abs_ns) {
+    std::unique_lock<std::mutex> lock(submitMutex);
+    if (pendingSubmits == 0)
+        return true;
+
+    auto timePoint =
+        std::chrono::steady_clock::time_point(std::chrono::nanoseconds(timeout_abs_ns));
+    return submitCondition.wait_until(lock, timePoint, [this] { return pendingSubmits == 0; });
+}
+
+bool VPUJob::waitForTimeline(int64_t timeout_abs_ns) {
+    VPUEventCommand::KMDEventDataType *fence = nullptr;
+    uint64_t value = 0;
+    {
+        const std::lock_guard<std::mutex> lock(timelineMutex);
+        fence = timelineFence;
+        value = timelineValue;
+    }
+    if (fence == nullptr)
+        return true;
+
+    auto isReached = [value](uint64_t fenceValue) { return fenceValue >= value; };
+    if (SpinWait::spinUntil(fence, isReached, timeout_abs_ns))
+        return true;
+
+    // Spin time has passed, the wait continues in kernel driver
+    int64_t nowNs = std::chrono::steady_clock::now().time_since_epoch().count();
+    if (nowNs < timeout_abs_ns)
+        return true;
+
+    int64_t lastProbe = lastTimelineProbe.load();
+    return nowNs - lastProbe >= std::chrono::nanoseconds(timelineProbeInterval).count() &&
+           lastTimelineProbe.compare_exchange_strong(lastProbe, nowNs);
+}
+
 bool VPUJob::waitForCompletion(int64_t timeout_abs_ns) {
+    if (!waitForSubmit(timeout_abs_ns))
+        return false;
+
+    // Command buffers of job that failed to submit are never executed
+    if (submitFailed)
+        return true;
+
+    if (!waitForTimeline(timeout_abs_ns))
+        return false;
+
+    // Device signals the timeline only after every command buffer of the job has succeeded
+    if (isTimelineSignaled()) {
+        for (const auto &cmdBuffer : cmdBuffers)
+            cmdBuffer->setSuccess();
+        return true;
+    }
+
     for (const auto &cmdBuffer : cmdBuffers)
         if (!cmdBuffer->waitForCompletion(timeout_abs_ns))
             return false;
@@ -102,6 +300,9 @@ bool VPUJob::waitForCompletion(int64_t timeout_abs_ns) {
 }
 
 bool VPUJob::isSuccess() const {
+    if (submitFailed)
+        return false;
+
     for (const auto &cmdBuffer : cmdBuffers)
         if (!cmdBuffer->isSuccess())
             return false;
@@ -110,6 +311,9 @@ bool VPUJob::isSuccess() const {
 }
 
 uint64_t VPUJob::getStatus() const {
+    if (submitFailed)
+        return std::numeric_limits<uint32_t>::max();
+
     for (const auto &cmdBuffer : cmdBuffers) {
         auto status = cmdBuffer->getResult();
         if (status != DRM_IVPU_JOB_STATUS_SUCCESS)
@@ -152,19 +356,4 @@ bool VPUJob::appendCommand(std::shared_ptr<VPUCommand> cmd) {
     return true;
 }
 
-std::vector<std::shared_ptr<VPUCommand>>::iterator
-VPUJob::scheduleCommands(std::vector<std::shared_ptr<VPUCommand>>::iterator begin) {
-    auto it = begin;
-    for (; it != commands.end(); it++) {
-        const auto &cmd = *it;
-
-        if (cmd->isSynchronizeCommand()) {
-            it++;
-            break;
-        }
-    }
-
-    return it;
-}
-
 } // namespace VPU
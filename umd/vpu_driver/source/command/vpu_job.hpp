@@ -15,7 +15,10 @@
 #include "vpu_driver/source/command/vpu_event_command.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace VPU {
@@ -24,7 +27,19 @@ class VPUDeviceContext;
 
 class VPUJob {
   public:
-    VPUJob(VPUDeviceContext *ctx);
+    /**
+     * @param spareBuffers[in]: Command buffer storage of previous job, reused by closeCommands
+     * when the recording fits
+     */
+    VPUJob(VPUDeviceContext *ctx, std::vector<std::shared_ptr<VPUBufferObject>> spareBuffers = {});
+
+    /**
+     * Create closed job with commands of the given jobs in order. The commands are put into
+     * a single command buffer as in a single job.
+     * @return nullptr on failure
+     */
+    static std::shared_ptr<VPUJob> createFused(VPUDeviceContext *ctx,
+                                               const std::vector<std::shared_ptr<VPUJob>> &jobs);
 
     /**
      * Finalize building the job by moving commands into appropriate VPUCommandBuffers
@@ -82,11 +97,108 @@ class VPUJob {
 
     bool isClosed() const { return closed; }
 
+    /**
+     * Move buffer objects out of command buffers to be reused by another job. Only buffer objects
+     * held by the job alone are returned. The job is left without command buffers, it must not be
+     * submitted afterwards.
+     */
+    std::vector<std::shared_ptr<VPUBufferObject>> takeCommandBufferStorage();
+
     void setNeedsUpdate(bool value) { needsUpdate = value; }
 
+    /**
+     * Order the job after another one on the device. Must be called before closeCommands.
+     * The first command buffer waits for the fence and the last one signals the completion fence,
+     * command buffers in between are chained as on engine switch.
+     * @param fence[in]: Completion fence of the preceding job, nullptr if there is none
+     * @param fenceBo[in]: Buffer object of the fence, kept alive by the job
+     */
+    void setOrderingFence(VPUEventCommand::KMDEventDataType *fence,
+                          std::shared_ptr<VPUBufferObject> fenceBo);
+
+    /**
+     * Order the job after the given job, see setOrderingFence. The job is not submitted if the
+     * preceding job fails to submit.
+     * @param job[in]: Preceding job, nullptr if there is none
+     */
+    void setPrecedingJob(std::shared_ptr<VPUJob> job);
+
+    /**
+     * Release the preceding job, called by VPUDeviceQueue on submission
+     */
+    std::shared_ptr<VPUJob> takePrecedingJob() { return std::move(precedingJob); }
+
+    /**
+     * Set the job that submitted commands of this job as a part of fused job
+     */
+    void setFusedJob(const std::shared_ptr<VPUJob> &job) { fusedJob = job; }
+    std::shared_ptr<VPUJob> getFusedJob() const { return fusedJob.lock(); }
+
+    /**
+     * Fence signaled on the device after the last command buffer of the ordered job
+     */
+    VPUEventCommand::KMDEventDataType *getCompletionFence() const { return completionFence; }
+    const std::shared_ptr<VPUBufferObject> &getCompletionFenceBo() const {
+        return completionFenceBo;
+    }
+
+    /**
+     * Mark the job as queued for submission on another thread. Wait for completion blocks until
+     * every queued submission is done.
+     */
+    void setSubmitPending();
+
+    /**
+     * Complete submission queued by setSubmitPending
+     * @param success[in]: false if the job could not be submitted, the job then reports failure.
+     * Its completion fence is never signaled, jobs ordered after it are not submitted.
+     * @param error[in]: errno of the failed submission
+     */
+    void setSubmitDone(bool success, int error = 0);
+
+    bool isSubmitFailed() const { return submitFailed; }
+
+    /**
+     * Return errno of the failed queued submission, 0 if the submission did not fail
+     */
+    int getSubmitError() const { return submitFailed ? submitError : 0; }
+
+    /**
+     * Wait until queued submissions of the job are done
+     * @return false on timeout
+     */
+    bool waitForSubmit(int64_t timeout_abs_ns);
+
+    /**
+     * Point the completion signal of the last command buffer to the queue timeline fence.
+     * Called by VPUDeviceQueue right before the submission.
+     * @param fenceBo[in]: Buffer object of the timeline fence, kept alive by the job
+     * @param fence[in]: Timeline fence of the queue
+     * @param value[in]: Timeline value of the submission
+     * @return false if the command buffer might be still executed by the device, the submission
+     * is then not tracked by the timeline fence
+     */
+    bool setTimelineSignal(std::shared_ptr<VPUBufferObject> fenceBo,
+                           VPUEventCommand::KMDEventDataType *fence,
+                           uint64_t value);
+
+    /**
+     * Stop tracking the job by the timeline fence, used when the submission failed
+     */
+    void clearTimelineSignal();
+
+    bool isTimelineTracked();
+    bool isTimelineSignaled();
+    VPUEventCommand::KMDEventDataType *getTimelineFence();
+    uint64_t getTimelineValue();
+
   private:
-    std::vector<std::shared_ptr<VPUCommand>>::iterator
-    scheduleCommands(std::vector<std::shared_ptr<VPUCommand>>::iterator begin);
+    /**
+     * Wait for the timeline fence without asking the kernel driver
+     * @return false if the job is still running, true if the job has completed or the kernel
+     * driver has to be asked
+     */
+    bool waitForTimeline(int64_t timeout_abs_ns);
 
     bool createCommandBuffer(const std::vector<std::shared_ptr<VPUCommand>>::iterator &begin,
                              const std::vector<std::shared_ptr<VPUCommand>>::iterator &end,
@@ -97,8 +209,35 @@ class VPUJob {
 
     std::vector<std::unique_ptr<VPUCommandBuffer>> cmdBuffers;
     std::vector<std::shared_ptr<VPUCommand>> commands;
+    std::vector<std::shared_ptr<VPUBufferObject>> spareBuffers;
     bool closed = false;
     bool needsUpdate = false;
+
+    bool ordered = false;
+    VPUEventCommand::KMDEventDataType *orderingFence = nullptr;
+    std::shared_ptr<VPUBufferObject> orderingFenceBo;
+    VPUEventCommand::KMDEventDataType *completionFence = nullptr;
+    std::shared_ptr<VPUBufferObject> completionFenceBo;
+    // Held until the job is submitted
+    std::shared_ptr<VPUJob> precedingJob;
+    std::weak_ptr<VPUJob> fusedJob;
+
+    std::mutex submitMutex;
+    std::condition_variable submitCondition;
+    uint32_t pendingSubmits = 0;
+    std::atomic<bool> submitFailed = false;
+    int submitError = 0;
+
+    // Guards the timeline fence and value, written by submitting thread and read by any thread
+    // waiting for the job
+    std::mutex timelineMutex;
+    std::shared_ptr<VPUBufferObject> timelineFenceBo;
+    VPUEventCommand::KMDEventDataType *timelineFence = nullptr;
+    uint64_t timelineValue = 0;
+    // Last submission was not tracked by the timeline fence
+    bool untrackedSubmit = false;
+    // Time of the last completion check done by kernel driver, in nanoseconds
+    std::atomic<int64_t> lastTimelineProbe = 0;
 };
 
 } // namespace VPU
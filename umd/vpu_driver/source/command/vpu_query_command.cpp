@@ -75,7 +75,7 @@ VPUQueryCommand::VPUQueryCommand(vpu_cmd_type cmdType,
     cmd.header.size = sizeof(vpu_cmd_metric_query_t);
     cmd.metric_group_type = groupMask;
     cmd.metric_data_address = metricDataAddress;
-    command.emplace<vpu_cmd_metric_query_t>(cmd);
+    command.metricQuery = cmd;
     appendAssociateBufferObject(std::move(bo));
 }
 
@@ -11,7 +11,6 @@
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "vpu_driver/source/command/vpu_command.hpp"
 
-#include <any>
 #include <memory>
 #include <utility>
 
@@ -25,10 +24,6 @@ class VPUQueryCommand : public VPUCommand {
                     void *dataAddress,
                     std::shared_ptr<VPUBufferObject> bo,
                     uint64_t metricDataAddress);
-    const vpu_cmd_header_t *getHeader() const {
-        return reinterpret_cast<const vpu_cmd_header_t *>(
-            std::any_cast<vpu_cmd_metric_query_t>(&command));
-    }
 
   private:
     static const char *getQueryCommandStr(const vpu_cmd_type cmdType);
@@ -44,7 +44,7 @@ VPUTimeStampCommand::VPUTimeStampCommand(uint32_t type,
     cmd.header.size = sizeof(vpu_cmd_timestamp_t);
     cmd.timestamp_address = dstVPUAddr;
     cmd.type = type;
-    command.emplace<vpu_cmd_timestamp_t>(cmd);
+    command.timestamp = cmd;
     appendAssociateBufferObject(std::move(dstBo));
     LOG(VPU_CMD, "Timestamp Command successfully created!");
 }
@@ -11,7 +11,6 @@
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "vpu_driver/source/command/vpu_command.hpp"
 
-#include <any>
 #include <memory>
 
 namespace VPU {
@@ -23,11 +22,6 @@ class VPUTimeStampCommand : public VPUCommand {
 
     static std::shared_ptr<VPUTimeStampCommand>
     create(uint64_t *dstPtr, std::shared_ptr<VPUBufferObject> dstBo, uint32_t type = 0);
-
-    const vpu_cmd_header_t *getHeader() const {
-        return reinterpret_cast<const vpu_cmd_header_t *>(
-            std::any_cast<vpu_cmd_timestamp_t>(&command));
-    }
 };
 
 } // namespace VPU
@@ -11,23 +11,113 @@
 
 #include "umd_common.hpp"
 #include "vpu_driver/source/command/vpu_command_buffer.hpp"
+#include "vpu_driver/source/command/vpu_event_command.hpp"
 #include "vpu_driver/source/command/vpu_job.hpp"
 #include "vpu_driver/source/device/hw_info.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/memory/vpu_slab_allocator.hpp"
 #include "vpu_driver/source/os_interface/vpu_driver_api.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
+#include <algorithm>
+#include <charconv>
 #include <chrono> // IWYU pragma: keep
 #include <errno.h>
 #include <memory>
+#include <stdlib.h>
+#include <string_view>
 #include <thread>
 #include <uapi/drm/ivpu_accel.h>
 #include <vector>
 
 namespace VPU {
 
-template <typename T>
-bool submitWithWait(const VPUJob *job, T &&submitFunc) {
+VPUDeviceQueue::SubmitRetryConfig VPUDeviceQueue::getSubmitRetryConfigFromEnv() {
+    SubmitRetryConfig config;
+
+    const char *env = getenv("ZE_INTEL_NPU_SUBMIT_WAIT_COMPLETION");
+    if (env) {
+        std::string_view envStr = env;
+        config.waitForCompletion = envStr != "0";
+    }
+
+    env = getenv("ZE_INTEL_NPU_SUBMIT_BACKOFF_MAX_US");
+    if (env) {
+        uint64_t val = static_cast<uint64_t>(config.maxBackoff.count());
+        std::string_view envStr = env;
+        // On error "from_chars" function leave "val" unmodified
+        std::from_chars(envStr.begin(), envStr.end(), val);
+        config.maxBackoff = std::chrono::microseconds(val);
+        config.minBackoff = std::min(config.minBackoff, config.maxBackoff);
+    }
+
+    return config;
+}
+
+VPUDeviceQueue::SubmitRetryStats VPUDeviceQueue::getSubmitRetryStats() const {
+    SubmitRetryStats stats;
+    stats.busyCount = busyCount.load();
+    stats.completionWaits = completionWaits.load();
+    stats.backoffSleeps = backoffSleeps.load();
+    stats.timeouts = timeouts.load();
+    return stats;
+}
+
+void VPUDeviceQueue::trackInFlight(const std::shared_ptr<VPUBufferObject> &buffer) {
+    const std::lock_guard<std::mutex> lock(inFlightMutex);
+    while (!inFlight.empty() &&
+           (inFlight.front().expired() || inFlight.size() >= maxInFlightTracked))
+        inFlight.pop_front();
+    inFlight.emplace_back(buffer);
+}
+
+bool VPUDeviceQueue::waitForOldestInFlight(std::chrono::steady_clock::time_point deadline) {
+    std::shared_ptr<VPUBufferObject> oldest;
+    {
+        const std::lock_guard<std::mutex> lock(inFlightMutex);
+        while (!inFlight.empty() && oldest == nullptr) {
+            oldest = inFlight.front().lock();
+            inFlight.pop_front();
+        }
+    }
+
+    if (oldest == nullptr)
+        return false;
+
+    drm_ivpu_bo_wait args = {};
+    args.handle = oldest->getHandle();
+    args.timeout_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+    if (pDriverApi->wait(&args) != 0) {
+        LOG(CMDQUEUE, "Wait for command buffer in flight failed, errno: %d", errno);
+        return false;
+    }
+
+    completionWaits++;
+    return true;
+}
+
+uint64_t VPUDeviceQueue::getTimelineValue() {
+    const std::lock_guard<std::mutex> lock(submitMutex);
+    return timelineValues[timelineSlot];
+}
+
+void VPUDeviceQueue::initTimelineFence() {
+    timelineInitialized = true;
+    auto chunk = ctx->createUntrackedBufferChunk(
+        timelineSlots * sizeof(VPUEventCommand::JsmEventData),
+        VPUBufferObject::Type::CachedFw);
+    if (chunk == nullptr) {
+        LOG_W("Failed to allocate timeline fence, jobs are tracked by kernel driver only");
+        return;
+    }
+
+    timelineFences = chunk->getBasePointer();
+    timelineFenceBo = chunk->getBufferObject();
+}
+
+bool VPUDeviceQueue::submitWithRetry(VPUJob *job) {
     if (job == nullptr) {
         LOG_W("Invalid argument - job is nullptr");
         return false;
@@ -37,28 +127,73 @@ bool submitWithWait(const VPUJob *job, T &&submitFunc) {
         LOG_E("Invalid argument - no command buffer in job");
         return false;
     }
+
+    // Job ordered after a job that was never submitted would wait for its fence forever
+    auto precedingJob = job->takePrecedingJob();
+    if (precedingJob != nullptr && precedingJob->isSubmitFailed()) {
+        LOG_E("Job %p is ordered after job %p that failed to submit", job, precedingJob.get());
+        errno = precedingJob->getSubmitError();
+        return false;
+    }
+
+    const std::lock_guard<std::mutex> lock(submitMutex);
+    if (!timelineInitialized)
+        initTimelineFence();
+
+    bool timelineTracked = false;
+    if (timelineFenceBo) {
+        auto *fence = reinterpret_cast<VPUEventCommand::KMDEventDataType *>(
+            timelineFences + timelineSlot * sizeof(VPUEventCommand::JsmEventData));
+        uint64_t value = timelineValues[timelineSlot] + 1;
+        timelineTracked = job->setTimelineSignal(timelineFenceBo, fence, value);
+        if (timelineTracked)
+            timelineValues[timelineSlot] = value;
+    }
+
+    bool success = submitCommandBuffers(job);
+    // Kernel driver keeps the timeline fence alive for the submitted job
+    job->getCommandBuffers().back()->releaseTimelineHandle();
+    if (!success) {
+        if (timelineTracked)
+            job->clearTimelineSignal();
+        return false;
+    }
+    return true;
+}
+
+bool VPUDeviceQueue::submitCommandBuffers(const VPUJob *job) {
     for (const auto &cmdBuffer : job->getCommandBuffers()) {
-        constexpr auto pollTime = std::chrono::seconds(2);
-        const auto timeoutPoint = std::chrono::steady_clock::now() + pollTime;
+        const auto deadline = std::chrono::steady_clock::now() + retryConfig.timeout;
+        auto backoff = retryConfig.minBackoff;
 
-        while ((submitFunc)(cmdBuffer) < 0) {
+        while (submitCommandBuffer(cmdBuffer) < 0) {
             /*
-             * SUBMIT ioctl returns EBUSY if command queue is full. Driver should wait till firmware
-             * completes a job and make a space for new job in queue. Polling time is set to 2
-             * seconds to match with TDR timeout.
+             * SUBMIT ioctl returns EBUSY if command queue is full. Driver waits till firmware
+             * completes the oldest job submitted through this queue, which makes a space for new
+             * job. When there is nothing to wait for, e.g. queue is filled by other process,
+             * driver sleeps with exponential backoff.
              */
             if (errno != EBUSY) {
                 LOG_E("Failed to submit command buffer: %p", cmdBuffer.get());
                 return false;
             }
+            busyCount++;
 
-            if (std::chrono::steady_clock::now() > timeoutPoint) {
+            if (std::chrono::steady_clock::now() >= deadline) {
                 LOG_E("Timed out waiting for driver to submit a job");
+                timeouts++;
                 return false;
             }
 
-            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            if (retryConfig.waitForCompletion && waitForOldestInFlight(deadline))
+                continue;
+
+            backoffSleeps++;
+            std::this_thread::sleep_for(backoff);
+            backoff = std::min(backoff * 2, retryConfig.maxBackoff);
         }
+
+        trackInFlight(cmdBuffer->getBuffer());
     }
     LOG(DEVICE, "Buffers execution successfully triggered");
     return true;
@@ -67,6 +202,16 @@ bool submitWithWait(const VPUJob *job, T &&submitFunc) {
 VPUDeviceQueue::VPUDeviceQueue(VPUDriverApi *api)
     : pDriverApi(api) {}
 
+VPUDeviceQueue::~VPUDeviceQueue() {
+    if (busyCount > 0)
+        LOG(CMDQUEUE,
+            "Submit retries: busy: %lu, completion waits: %lu, backoff sleeps: %lu, timeouts: %lu",
+            busyCount.load(),
+            completionWaits.load(),
+            backoffSleeps.load(),
+            timeouts.load());
+}
+
 std::unique_ptr<VPUDeviceQueue>
 VPUDeviceQueue::create(VPUDeviceContext *VPUContext, Priority queuePriority, bool isTurboMode) {
     if (!VPUContext) {
@@ -78,6 +223,7 @@ VPUDeviceQueue::create(VPUDeviceContext *VPUContext, Priority queuePriority, boo
         LOG_E("Driver Api does not exist");
         return nullptr;
     }
+    std::unique_ptr<VPUDeviceQueue> queue;
     if (VPUContext->getDeviceCapabilities().cmdQueueCreationCapability) {
         uint32_t defaultQueue;
         if (pApi->commandQueueCreate(static_cast<uint32_t>(queuePriority),
@@ -87,11 +233,14 @@ VPUDeviceQueue::create(VPUDeviceContext *VPUContext, Priority queuePriority, boo
             return nullptr;
         }
 
-        return std::make_unique<VPUDeviceQueueManaged>(pApi, defaultQueue, isTurboMode);
+        queue = std::make_unique<VPUDeviceQueueManaged>(pApi, defaultQueue, isTurboMode);
+    } else {
+        LOG(CMDQUEUE, "Continue creating queue with default mode");
+        queue = std::make_unique<VPUDeviceQueueLegacy>(pApi, queuePriority);
     }
 
-    LOG(CMDQUEUE, "Continue creating queue with default mode");
-    return std::make_unique<VPUDeviceQueueLegacy>(pApi, queuePriority);
+    queue->ctx = VPUContext;
+    return queue;
 }
 
 VPUDeviceQueueLegacy::VPUDeviceQueueLegacy(VPUDriverApi *api, Priority queuePriority)
@@ -119,17 +268,21 @@ int VPUDeviceQueueLegacy::submitCommandBuffer(const std::unique_ptr<VPUCommandBu
     return pDriverApi->submitCommandBuffer(&execParam);
 }
 
-bool VPUDeviceQueueLegacy::submit(const VPUJob *job) {
-    return submitWithWait(job, [this](auto &cmdBuf) { return this->submitCommandBuffer(cmdBuf); });
+bool VPUDeviceQueueLegacy::submit(VPUJob *job) {
+    return submitWithRetry(job);
 }
 
 bool VPUDeviceQueueLegacy::toBackgroundPriority() {
+    const std::lock_guard<std::mutex> lock(submitMutex);
     priority = Priority::IDLE;
+    timelineSlot = 1;
     return true;
 }
 
 bool VPUDeviceQueueLegacy::toDefaultPriority() {
+    const std::lock_guard<std::mutex> lock(submitMutex);
     priority = defaultPriority;
+    timelineSlot = 0;
     return true;
 }
 
@@ -155,11 +308,12 @@ int VPUDeviceQueueManaged::submitCommandBuffer(const std::unique_ptr<VPUCommandB
                                           currentId);
 }
 
-bool VPUDeviceQueueManaged::submit(const VPUJob *job) {
-    return submitWithWait(job, [this](auto &cmdBuf) { return this->submitCommandBuffer(cmdBuf); });
+bool VPUDeviceQueueManaged::submit(VPUJob *job) {
+    return submitWithRetry(job);
 }
 
 bool VPUDeviceQueueManaged::toBackgroundPriority() {
+    const std::lock_guard<std::mutex> lock(submitMutex);
     if (backgroundId == defaultId) {
         if (pDriverApi->commandQueueCreate(static_cast<uint32_t>(Priority::IDLE),
                                            backgroundId,
@@ -169,11 +323,14 @@ bool VPUDeviceQueueManaged::toBackgroundPriority() {
         }
     }
     currentId = backgroundId;
+    timelineSlot = 1;
     return true;
 }
 
 bool VPUDeviceQueueManaged::toDefaultPriority() {
+    const std::lock_guard<std::mutex> lock(submitMutex);
     currentId = defaultId;
+    timelineSlot = 0;
     return true;
 }
 
@@ -7,13 +7,21 @@
 
 #pragma once
 
+// IWYU pragma: no_include <bits/chrono.h>
+
 #include <stdint.h>
 
+#include <array>
+#include <atomic>
+#include <chrono> // IWYU pragma: keep
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <uapi/drm/ivpu_accel.h>
 
 namespace VPU {
 class VPUJob;
+class VPUBufferObject;
 class VPUCommandBuffer;
 class VPUDeviceContext;
 class VPUDriverApi;
@@ -27,20 +35,108 @@ class VPUDeviceQueue {
         REALTIME = DRM_IVPU_JOB_PRIORITY_REALTIME,
     };
 
-    virtual ~VPUDeviceQueue() = default;
+    /**
+     * Policy used when the kernel driver queue is full and submit returns EBUSY
+     */
+    struct SubmitRetryConfig {
+        // Block on the oldest command buffer in flight on this queue before sleeping
+        bool waitForCompletion = true;
+        // Sleep starts at minBackoff and doubles up to maxBackoff
+        std::chrono::microseconds minBackoff = std::chrono::microseconds(10);
+        std::chrono::microseconds maxBackoff = std::chrono::microseconds(1000);
+        // Matches TDR timeout
+        std::chrono::milliseconds timeout = std::chrono::seconds(2);
+    };
+
+    struct SubmitRetryStats {
+        // Submissions rejected with EBUSY
+        uint64_t busyCount = 0;
+        // Completed waits on the oldest command buffer in flight
+        uint64_t completionWaits = 0;
+        uint64_t backoffSleeps = 0;
+        uint64_t timeouts = 0;
+    };
+
+    virtual ~VPUDeviceQueue();
 
     static std::unique_ptr<VPUDeviceQueue>
     create(VPUDeviceContext *VPUContext, Priority queuePriority, bool isTurboMode);
 
-    virtual bool submit(const VPUJob *job) = 0;
+    /**
+     * Read submit retry policy from ZE_INTEL_NPU_SUBMIT_WAIT_COMPLETION and
+     * ZE_INTEL_NPU_SUBMIT_BACKOFF_MAX_US environment variables
+     */
+    static SubmitRetryConfig getSubmitRetryConfigFromEnv();
+
+    /**
+     * Submit all command buffers of the job. Jobs are tracked by the queue timeline fence, that
+     * is signaled by the device with increasing value at the end of every submission.
+     */
+    virtual bool submit(VPUJob *job) = 0;
+
+    /**
+     * Switch kernel driver queue used by the following submissions. Jobs queued for asynchronous
+     * submission keep the priority only if they are submitted before the switch.
+     */
     virtual bool toBackgroundPriority() = 0;
     virtual bool toDefaultPriority() = 0;
 
+    void setSubmitRetryConfig(const SubmitRetryConfig &config) { retryConfig = config; }
+    SubmitRetryStats getSubmitRetryStats() const;
+
+    /**
+     * Return timeline value of the last tracked submission to current kernel driver queue
+     */
+    uint64_t getTimelineValue();
+
   protected:
     VPUDeviceQueue(VPUDriverApi *api);
     virtual int submitCommandBuffer(const std::unique_ptr<VPUCommandBuffer> &cmdBuf) = 0;
 
+    /**
+     * Submit all command buffers of the job, retrying when the kernel driver queue is full
+     */
+    bool submitWithRetry(VPUJob *job);
+
     VPUDriverApi *pDriverApi;
+
+    // Keeps timeline values in submission order, guards the submission target of derived queues
+    std::mutex submitMutex;
+
+    /*
+     * Jobs are executed in order only within kernel driver queue. Every kernel driver queue used
+     * by this queue has own timeline fence. Slot 0 is used for default and 1 for background
+     * priority.
+     */
+    static constexpr size_t timelineSlots = 2;
+    size_t timelineSlot = 0;
+
+  private:
+    void initTimelineFence();
+    bool submitCommandBuffers(const VPUJob *job);
+
+    void trackInFlight(const std::shared_ptr<VPUBufferObject> &buffer);
+    bool waitForOldestInFlight(std::chrono::steady_clock::time_point deadline);
+
+    // Upper bound of tracked command buffers, older entries are dropped
+    static constexpr size_t maxInFlightTracked = 256;
+
+    SubmitRetryConfig retryConfig = getSubmitRetryConfigFromEnv();
+
+    std::mutex inFlightMutex;
+    std::deque<std::weak_ptr<VPUBufferObject>> inFlight;
+
+    // Timeline fence is allocated at the first submission
+    VPUDeviceContext *ctx = nullptr;
+    bool timelineInitialized = false;
+    std::shared_ptr<VPUBufferObject> timelineFenceBo;
+    uint8_t *timelineFences = nullptr;
+    std::array<uint64_t, timelineSlots> timelineValues = {};
+
+    std::atomic<uint64_t> busyCount = 0;
+    std::atomic<uint64_t> completionWaits = 0;
+    std::atomic<uint64_t> backoffSleeps = 0;
+    std::atomic<uint64_t> timeouts = 0;
 };
 
 class VPUDeviceQueueLegacy final : public VPUDeviceQueue {
@@ -48,7 +144,7 @@ class VPUDeviceQueueLegacy final : public VPUDeviceQueue {
     VPUDeviceQueueLegacy(VPUDriverApi *api, Priority queuePriority);
     virtual ~VPUDeviceQueueLegacy() = default;
 
-    bool submit(const VPUJob *job) override;
+    bool submit(VPUJob *job) override;
     bool toBackgroundPriority() override;
     bool toDefaultPriority() override;
 
@@ -65,7 +161,7 @@ class VPUDeviceQueueManaged final : public VPUDeviceQueue {
     VPUDeviceQueueManaged(VPUDriverApi *api, uint32_t defaultQueue, bool isTurboMode);
     virtual ~VPUDeviceQueueManaged() override;
 
-    bool submit(const VPUJob *job) override;
+    bool submit(VPUJob *job) override;
     bool toBackgroundPriority() override;
     bool toDefaultPriority() override;
 
@@ -14,6 +14,7 @@
 
 #include <exception>
 #include <memory>
+#include <string.h>
 #include <uapi/drm/ivpu_accel.h>
 
 namespace VPU {
@@ -21,7 +22,9 @@ struct VPUDescriptor;
 
 VPUDeviceContext::VPUDeviceContext(std::unique_ptr<VPUDriverApi> drvApi, VPUHwInfo *info)
     : drvApi(std::move(drvApi))
-    , hwInfo(info) {
+    , hwInfo(info)
+    , bufferCounters(std::make_shared<VPUBufferCounters>())
+    , bufferCache(std::make_shared<VPUBufferCache>(VPUBufferCache::getMaxSizeFromEnv())) {
     LOG(DEVICE, "VPUDeviceContext is created");
 }
 
@@ -46,44 +49,49 @@ VPUDeviceContext::importBufferObject(VPUBufferObject::Location type, int32_t fd)
         LOG_E("Failed to import VPUBufferObject from file descriptor");
         return nullptr;
     }
-    void *ptr = bo->getBasePointer();
 
-    const std::lock_guard<std::mutex> lock(mtx);
-    auto [it, success] = trackedBuffers.emplace(ptr, std::move(bo));
-    if (!success) {
+    if (!trackedBuffers.insert(bo)) {
         LOG_E("Failed to add buffer object to trackedBuffers");
         return nullptr;
     }
-    LOG(DEVICE, "Buffer object %p successfully imported and added to trackedBuffers", &it->second);
-    return it->second;
+    bufferCounters->add(*bo);
+    LOG(DEVICE, "Buffer object %p successfully imported and added to trackedBuffers", bo.get());
+    return bo;
 }
 
 std::shared_ptr<VPUBufferObject>
 VPUDeviceContext::createBufferObject(size_t size,
                                      VPUBufferObject::Type type,
-                                     VPUBufferObject::Location loc) {
+                                     VPUBufferObject::Location loc,
+                                     VPUBufferObject::Mapping mapping) {
     if (!hwInfo->dmaMemoryRangeCapability && (static_cast<uint32_t>(type) & DRM_IVPU_BO_DMA_MEM))
         type = convertDmaToShaveRange(type);
 
-    auto bo = VPUBufferObject::create(*drvApi, loc, type, size);
+    auto bo = VPUBufferObject::create(*drvApi, loc, type, size, mapping);
     if (bo == nullptr) {
         LOG_E("Failed to create VPUBufferObject");
         return nullptr;
     }
 
+    // Tracked memory is identified by the CPU address, lazily mapped buffer object is mapped here
+    if (bo->getBasePointer() == nullptr) {
+        LOG_E("Failed to map VPUBufferObject");
+        bo->allowDeleteExternalHandle();
+        return nullptr;
+    }
+
     LOG(DEVICE,
         "Create BO: %p, cpu: %p, vpu: %#lx",
         bo.get(),
         bo->getBasePointer(),
         bo->getVPUAddr());
 
-    const std::lock_guard<std::mutex> lock(mtx);
-    auto [it, success] = trackedBuffers.emplace(bo->getBasePointer(), std::move(bo));
-    if (!success) {
+    if (!trackedBuffers.insert(bo)) {
         LOG_E("Failed to add buffer object to trackedBuffers");
         return nullptr;
     }
-    return it->second;
+    bufferCounters->add(*bo);
+    return bo;
 }
 
 bool VPUDeviceContext::freeMemAlloc(void *ptr) {
@@ -115,11 +123,11 @@ bool VPUDeviceContext::freeMemAlloc(std::shared_ptr<VPUBufferObject> bo) {
         bo->getBasePointer(),
         bo->getVPUAddr());
 
-    const std::lock_guard<std::mutex> lock(mtx);
-    if (trackedBuffers.erase(bo->getBasePointer()) == 0) {
+    if (trackedBuffers.erase(bo->getBasePointer()) == nullptr) {
         LOG_E("Failed to remove VPUBufferObject from trackedBuffers!");
         return false;
     }
+    bufferCounters->remove(*bo);
 
     MemoryStatistics::get().snapshot();
     return true;
@@ -131,19 +139,12 @@ std::shared_ptr<VPUBufferObject> VPUDeviceContext::findBufferObject(const void *
         return nullptr;
     }
 
-    const std::lock_guard<std::mutex> lock(mtx);
-    auto it = trackedBuffers.lower_bound(ptr);
-    if (it == trackedBuffers.end()) {
+    auto bo = trackedBuffers.find(ptr);
+    if (bo == nullptr) {
         LOG(DEVICE, "Could not find a pointer %p in VPUDeviceContext %p", ptr, this);
         return nullptr;
     }
 
-    auto &bo = it->second;
-    if (!bo->isInRange(ptr)) {
-        LOG(DEVICE, "Pointer %p is not in the allocation size in VPUDeviceContext %p", ptr, this);
-        return nullptr;
-    }
-
     return bo;
 }
 
@@ -157,17 +158,51 @@ VPUDeviceContext::createUntrackedBufferObject(size_t size, VPUBufferObject::Type
     if (!hwInfo->dmaMemoryRangeCapability && (static_cast<uint32_t>(range) & DRM_IVPU_BO_DMA_MEM))
         range = convertDmaToShaveRange(range);
 
-    auto bo = VPUBufferObject::create(*drvApi, VPUBufferObject::Location::Internal, range, size);
-    if (bo == nullptr) {
-        LOG_E("Failed to allocate shared memory, size = %lu, type = %i",
-              size,
-              static_cast<int>(range));
-        return nullptr;
-    }
-
-    const std::lock_guard<std::mutex> lock(mtx);
-    untrackedBuffers.emplace_back(bo);
-    return bo;
+    size_t alignedSize = getPageAlignedSize(size);
+    auto bo = bufferCache->acquire(range, alignedSize);
+    if (bo != nullptr) {
+        // Keep the same contract as a freshly created buffer object
+        const uint8_t zero = 0;
+        bo->fillBuffer(&zero, sizeof(zero));
+    } else {
+        bo = VPUBufferObject::create(*drvApi,
+                                     VPUBufferObject::Location::Internal,
+                                     range,
+                                     alignedSize);
+        if (bo == nullptr && bufferCache->getCachedCount() > 0) {
+            // Memory kept in the cache may be what the kernel driver is short of
+            LOG(DEVICE, "Release cached buffers and retry allocation, size = %lu", alignedSize);
+            bufferCache->clear();
+            bo = VPUBufferObject::create(*drvApi,
+                                         VPUBufferObject::Location::Internal,
+                                         range,
+                                         alignedSize);
+        }
+        if (bo == nullptr) {
+            LOG_E("Failed to allocate shared memory, size = %lu, type = %i",
+                  size,
+                  static_cast<int>(range));
+            return nullptr;
+        }
+    }
+
+    // The returned pointer shares the buffer object, the last reference deregisters it from the
+    // accounting and hands it back to cache, so the context does not keep a list of them
+    auto *rawBo = bo.get();
+    std::shared_ptr<VPUBufferObject> cachedBo(
+        rawBo,
+        [owner = std::move(bo),
+         counters = bufferCounters,
+         cache = std::weak_ptr<VPUBufferCache>(bufferCache)](VPUBufferObject *) mutable {
+            counters->remove(*owner);
+            auto bufferCache = cache.lock();
+            if (bufferCache)
+                bufferCache->release(std::move(owner));
+            owner.reset();
+        });
+
+    bufferCounters->add(*cachedBo);
+    return cachedBo;
 }
 
 size_t VPUDeviceContext::getPageAlignedSize(size_t reqSize) {
@@ -12,7 +12,12 @@
 
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "vpu_driver/source/device/hw_info.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_cache.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_counters.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_index.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/memory/vpu_shared_buffers.hpp"
+#include "vpu_driver/source/memory/vpu_slab_allocator.hpp"
 #include "vpu_driver/source/os_interface/vpu_driver_api.hpp"
 #include "vpu_driver/source/utilities/stats.hpp"
 
@@ -36,9 +41,17 @@ class VPUDeviceContext {
     VPUDeviceContext(VPUDeviceContext const &) = delete;
     VPUDeviceContext &operator=(VPUDeviceContext const &) = delete;
 
+    /**
+       Allocate tracked memory. Tracked memory is identified by the CPU address, so the returned
+       allocation is always mapped.
+       @return CPU address of the allocation, nullptr on failure
+     */
     inline void *
-    createMemAlloc(size_t size, VPUBufferObject::Type type, VPUBufferObject::Location loc) {
-        auto bo = createBufferObject(size, type, loc);
+    createMemAlloc(size_t size,
+                   VPUBufferObject::Type type,
+                   VPUBufferObject::Location loc,
+                   VPUBufferObject::Mapping mapping = VPUBufferObject::Mapping::Immediate) {
+        auto bo = createBufferObject(size, type, loc, mapping);
         if (bo == nullptr)
             return nullptr;
         MemoryStatistics::get().snapshot();
@@ -57,6 +70,11 @@ class VPUDeviceContext {
      */
     bool freeMemAlloc(void *ptr);
 
+    /**
+       Find tracked buffer object that contains given CPU address. The lookup does not take any
+       lock.
+       @return pointer to VPUBufferObject, nullptr if the pointer is not tracked
+     */
     std::shared_ptr<VPUBufferObject> findBufferObject(const void *ptr) const;
 
     /**
@@ -64,8 +82,32 @@ class VPUDeviceContext {
      */
     size_t getPageAlignedSize(size_t size);
 
+    /**
+       Create internal VPUBufferObject that is not tracked by pointer. The size is page aligned
+       and the buffer is recycled through the buffer cache once the last reference is dropped.
+       Memory of the returned buffer object is always zeroed.
+     */
     std::shared_ptr<VPUBufferObject> createUntrackedBufferObject(size_t size,
                                                                  VPUBufferObject::Type range);
+
+    /**
+       Create 64 bytes aligned chunk of internal memory shared with other small allocations.
+       Memory of the returned chunk is always zeroed.
+     */
+    std::shared_ptr<VPUBufferChunk> createUntrackedBufferChunk(size_t size,
+                                                               VPUBufferObject::Type range) {
+        return slabAllocator.allocate(size, range);
+    }
+
+    /**
+     * Return cache of released internal buffer objects
+     */
+    VPUBufferCache &getBufferCache() const { return *bufferCache; }
+
+    /**
+     * Return registry of buffer objects with immutable content shared by users of the context
+     */
+    VPUSharedBuffers &getSharedBuffers() { return sharedBuffers; }
     std::shared_ptr<VPUBufferObject> importBufferObject(VPUBufferObject::Location type, int32_t fd);
     int getFd() const { return drvApi->getFd(); }
 
@@ -94,44 +136,18 @@ class VPUDeviceContext {
     /**
      * Return number of currently tracking buffer objects in the structure
      */
-    size_t getBuffersCount() {
-        size_t untrackedCount = 0;
-        const std::lock_guard<std::mutex> lock(mtx);
-        for (auto &obj : untrackedBuffers) {
-            if (!obj.expired())
-                untrackedCount++;
-        }
-        return trackedBuffers.size() + untrackedCount;
-    }
+    size_t getBuffersCount() const { return bufferCounters->getTotal().count; }
 
     /**
-     * Return size of currently tracking buffer objects in the structure
+     * Return size of currently tracking buffer objects in the structure, buffers kept in the
+     * buffer cache are not included
      */
-    size_t getAllocatedSize() {
-        size_t size = 0;
-
-        const std::lock_guard<std::mutex> lock(mtx);
-        for (auto &obj : untrackedBuffers) {
-            auto bo = obj.lock();
-            if (bo)
-                size += bo->getAllocSize();
-        }
-        for (const auto &buffer : trackedBuffers)
-            size += buffer.second->getAllocSize();
-
-        return size;
-    }
+    size_t getAllocatedSize() const { return bufferCounters->getTotal().size; }
 
     /**
-     * Removes expired buffer objects from untrackedBuffers vector
+     * Return per location and per type accounting of tracking buffer objects
      */
-    void removeExpiredInternalBuffers() {
-        const std::lock_guard<std::mutex> lock(mtx);
-        untrackedBuffers.erase(std::remove_if(untrackedBuffers.begin(),
-                                              untrackedBuffers.end(),
-                                              [](auto x) { return x.expired(); }),
-                               untrackedBuffers.end());
-    }
+    const VPUBufferCounters &getBufferCounters() const { return *bufferCounters; }
 
     /**
      * Return inference ID from kernel driver that is unique for VPU
@@ -152,15 +168,21 @@ class VPUDeviceContext {
      */
     std::shared_ptr<VPUBufferObject> createBufferObject(size_t size,
                                                         VPUBufferObject::Type range,
-                                                        VPUBufferObject::Location location);
+                                                        VPUBufferObject::Location location,
+                                                        VPUBufferObject::Mapping mapping);
 
     std::unique_ptr<VPUDriverApi> drvApi;
     VPUHwInfo *hwInfo;
 
-    std::map<const void *, std::shared_ptr<VPUBufferObject>, std::greater<const void *>>
-        trackedBuffers;
-    std::vector<std::weak_ptr<VPUBufferObject>> untrackedBuffers;
-    mutable std::mutex mtx;
+    VPUBufferIndex trackedBuffers;
+    // Shared with untracked buffer objects that may outlive the context
+    std::shared_ptr<VPUBufferCounters> bufferCounters;
+
+    VPUSlabAllocator slabAllocator{this};
+    VPUSharedBuffers sharedBuffers;
+
+    // Declared last to release cached buffers before the driver api is destroyed
+    std::shared_ptr<VPUBufferCache> bufferCache;
 };
 
 } // namespace VPU
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include "vpu_driver/source/device/vpu_submission_worker.hpp"
+
+#include "vpu_driver/source/command/vpu_job.hpp"
+#include "vpu_driver/source/device/vpu_command_queue.hpp"
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <errno.h>
+#include <utility>
+
+namespace VPU {
+
+static void updateMax(std::atomic<uint64_t> &max, uint64_t value) {
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (current < value && !max.compare_exchange_weak(current, value))
+        ;
+}
+
+VPUSubmissionWorker::VPUSubmissionWorker(VPUDeviceQueue &queue, size_t capacity)
+    : queue(queue)
+    , ring(capacity)
+    , thread(&VPUSubmissionWorker::run, this) {}
+
+VPUSubmissionWorker::~VPUSubmissionWorker() {
+    {
+        const std::lock_guard<std::mutex> lock(sleepMutex);
+        stop = true;
+    }
+    sleepCondition.notify_one();
+    thread.join();
+
+    auto stats = getStats();
+    LOG(CMDQUEUE,
+        "Submission worker: submitted: %lu, failed: %lu, batches: %lu, max depth: %lu, "
+        "latency avg: %lu us, max: %lu us",
+        stats.submitted,
+        stats.failed,
+        stats.batches,
+        stats.maxDepth,
+        stats.avgLatencyUs,
+        stats.maxLatencyUs);
+}
+
+void VPUSubmissionWorker::enqueue(std::shared_ptr<VPUJob> job) {
+    job->setSubmitPending();
+
+    Entry entry = {std::move(job), std::chrono::steady_clock::now()};
+    uint64_t depth = enqueued.fetch_add(1) + 1 - submitted.load() - failed.load();
+    updateMax(maxDepth, depth);
+
+    while (!ring.tryPush(std::move(entry))) {
+        // Ring is full, let the worker make a space
+        wakeUp();
+        std::this_thread::yield();
+    }
+
+    // Pairs with the fence in run(), either worker sees the entry or producer sees it sleeping
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping.load())
+        wakeUp();
+}
+
+void VPUSubmissionWorker::drain() {
+    wakeUp();
+    std::unique_lock<std::mutex> lock(sleepMutex);
+    drainCondition.wait(lock, [this] { return enqueued.load() == submitted + failed; });
+}
+
+VPUSubmissionWorker::Stats VPUSubmissionWorker::getStats() const {
+    Stats stats;
+    stats.submitted = submitted.load();
+    stats.failed = failed.load();
+    stats.batches = batches.load();
+    stats.depth = enqueued.load() - stats.submitted - stats.failed;
+    stats.maxDepth = maxDepth.load();
+    uint64_t done = stats.submitted + stats.failed;
+    stats.avgLatencyUs = done ? totalLatencyNs.load() / done / 1000 : 0;
+    stats.maxLatencyUs = maxLatencyNs.load() / 1000;
+    return stats;
+}
+
+void VPUSubmissionWorker::wakeUp() {
+    { const std::lock_guard<std::mutex> lock(sleepMutex); }
+    sleepCondition.notify_one();
+}
+
+void VPUSubmissionWorker::submit(Entry &entry) {
+    bool success = queue.submit(entry.job.get());
+    int error = success ? 0 : errno;
+    if (!success)
+        LOG_E("Asynchronous submission of job %p failed", entry.job.get());
+
+    auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - entry.enqueueTime)
+                       .count();
+    totalLatencyNs += static_cast<uint64_t>(latency);
+    updateMax(maxLatencyNs, static_cast<uint64_t>(latency));
+    (success ? submitted : failed)++;
+
+    entry.job->setSubmitDone(success, error);
+    entry.job.reset();
+}
+
+void VPUSubmissionWorker::run() {
+    for (;;) {
+        Entry entry;
+        bool anySubmitted = false;
+        while (ring.tryPop(entry)) {
+            submit(entry);
+            anySubmitted = true;
+        }
+        if (anySubmitted)
+            batches++;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        drainCondition.notify_all();
+        sleeping = true;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        sleepCondition.wait(lock, [this] { return stop || !ring.empty(); });
+        sleeping = false;
+
+        if (stop && ring.empty())
+            return;
+    }
+}
+
+} // namespace VPU
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vpu_driver/source/utilities/mpsc_ring.hpp"
+
+#include <atomic>
+#include <chrono> // IWYU pragma: keep
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace VPU {
+class VPUDeviceQueue;
+class VPUJob;
+
+/**
+ * Dedicated thread that submits jobs to VPUDeviceQueue.
+ *
+ * Jobs are passed through lock-free ring, enqueue returns without waiting for the ioctls. The
+ * worker drains everything queued since its last wake up and submits it back to back in the
+ * enqueue order. Job waits block until the job is submitted, see VPUJob::waitForSubmit.
+ */
+class VPUSubmissionWorker {
+  public:
+    struct Stats {
+        uint64_t submitted = 0;
+        uint64_t failed = 0;
+        // Number of wake ups that submitted at least one job
+        uint64_t batches = 0;
+        uint64_t depth = 0;
+        uint64_t maxDepth = 0;
+        // Time from enqueue to completed submit ioctl
+        uint64_t avgLatencyUs = 0;
+        uint64_t maxLatencyUs = 0;
+    };
+
+    static constexpr size_t defaultCapacity = 256;
+
+    VPUSubmissionWorker(VPUDeviceQueue &queue, size_t capacity = defaultCapacity);
+    ~VPUSubmissionWorker();
+
+    VPUSubmissionWorker(const VPUSubmissionWorker &) = delete;
+    VPUSubmissionWorker &operator=(const VPUSubmissionWorker &) = delete;
+
+    /**
+     * Queue job for submission, thread safe. Blocks only when the ring is full.
+     */
+    void enqueue(std::shared_ptr<VPUJob> job);
+
+    /**
+     * Block until every job queued so far is submitted
+     */
+    void drain();
+
+    Stats getStats() const;
+
+  private:
+    struct Entry {
+        std::shared_ptr<VPUJob> job;
+        std::chrono::steady_clock::time_point enqueueTime;
+    };
+
+    void run();
+    void submit(Entry &entry);
+    void wakeUp();
+
+    VPUDeviceQueue &queue;
+    MpscRing<Entry> ring;
+
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+    std::condition_variable drainCondition;
+    std::atomic<bool> sleeping = false;
+    bool stop = false;
+
+    std::atomic<uint64_t> enqueued = 0;
+    std::atomic<uint64_t> submitted = 0;
+    std::atomic<uint64_t> failed = 0;
+    std::atomic<uint64_t> batches = 0;
+    std::atomic<uint64_t> maxDepth = 0;
+    std::atomic<uint64_t> totalLatencyNs = 0;
+    std::atomic<uint64_t> maxLatencyNs = 0;
+
+    std::thread thread;
+};
+
+} // namespace VPU
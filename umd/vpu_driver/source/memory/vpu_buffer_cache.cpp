@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "vpu_driver/source/memory/vpu_buffer_cache.hpp"
+
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <stdlib.h>
+#include <string_view>
+
+namespace VPU {
+
+VPUBufferCache::VPUBufferCache(size_t maxSize, Clock::duration idleTimeout)
+    : maxSize(maxSize)
+    , idleTimeout(idleTimeout)
+    , lastTrim(Clock::now()) {
+    LOG(MEMORY, "Buffer cache is created, max size: %lu", maxSize);
+}
+
+size_t VPUBufferCache::getMaxSizeFromEnv() {
+    const char *env = getenv("ZE_INTEL_NPU_BO_CACHE_SIZE");
+    if (env) {
+        size_t val = defaultMaxSize;
+        std::string_view envStr = env;
+        // On error "from_chars" function leave "val" unmodified
+        std::from_chars(envStr.begin(), envStr.end(), val);
+        return val;
+    }
+    return defaultMaxSize;
+}
+
+std::shared_ptr<VPUBufferObject> VPUBufferCache::acquire(VPUBufferObject::Type type,
+                                                         size_t alignedSize) {
+    if (!isEnabled() || !isCacheable(type))
+        return nullptr;
+
+    std::vector<std::shared_ptr<VPUBufferObject>> dropped;
+    std::shared_ptr<VPUBufferObject> bo;
+    {
+        const std::lock_guard<std::mutex> lock(mtx);
+        trimLocked(Clock::now(), dropped);
+
+        auto it = entries.find({type, alignedSize});
+        if (it == entries.end() || it->second.empty()) {
+            missCount++;
+            return nullptr;
+        }
+
+        // The most recently released buffer is the most likely to be still in CPU caches
+        bo = std::move(it->second.back().bo);
+        it->second.pop_back();
+        if (it->second.empty())
+            entries.erase(it);
+
+        cachedSize -= alignedSize;
+        cachedCount--;
+        hitCount++;
+    }
+
+    LOG(MEMORY,
+        "Reuse BO: %p, size: %lu, type: %#x",
+        bo.get(),
+        alignedSize,
+        static_cast<uint32_t>(type));
+    return bo;
+}
+
+bool VPUBufferCache::release(std::shared_ptr<VPUBufferObject> bo) {
+    if (bo == nullptr)
+        return false;
+
+    size_t size = bo->getAllocSize();
+    if (!isEnabled() || !isCacheable(bo->getType()) || size > maxSize)
+        return false;
+
+    std::vector<std::shared_ptr<VPUBufferObject>> dropped;
+    const std::lock_guard<std::mutex> lock(mtx);
+    auto now = Clock::now();
+    trimLocked(now, dropped);
+
+    if (cachedSize + size > maxSize) {
+        LOG(MEMORY, "Buffer cache is full, drop BO: %p, size: %lu", bo.get(), size);
+        return false;
+    }
+
+    entries[{bo->getType(), size}].push_back({std::move(bo), now});
+    cachedSize += size;
+    cachedCount++;
+    peakCachedSize = std::max(peakCachedSize, cachedSize);
+    peakCachedCount = std::max(peakCachedCount, cachedCount);
+    return true;
+}
+
+void VPUBufferCache::trim() {
+    std::vector<std::shared_ptr<VPUBufferObject>> dropped;
+    const std::lock_guard<std::mutex> lock(mtx);
+    trimLocked(Clock::now(), dropped);
+}
+
+void VPUBufferCache::clear() {
+    decltype(entries) dropped;
+    const std::lock_guard<std::mutex> lock(mtx);
+    dropped.swap(entries);
+    cachedSize = 0;
+    cachedCount = 0;
+}
+
+void VPUBufferCache::trimLocked(Clock::time_point now,
+                                std::vector<std::shared_ptr<VPUBufferObject>> &dropped) {
+    // Sweep the pool at most once per idle period to keep acquire and release cheap
+    if (now - lastTrim < idleTimeout)
+        return;
+    lastTrim = now;
+
+    for (auto it = entries.begin(); it != entries.end();) {
+        auto &bucket = it->second;
+        // Entries are appended in release order, the oldest are at the front
+        auto idleEnd = bucket.begin();
+        while (idleEnd != bucket.end() && now - idleEnd->releaseTime >= idleTimeout) {
+            cachedSize -= idleEnd->bo->getAllocSize();
+            cachedCount--;
+            dropped.push_back(std::move(idleEnd->bo));
+            idleEnd++;
+        }
+        bucket.erase(bucket.begin(), idleEnd);
+
+        if (bucket.empty())
+            it = entries.erase(it);
+        else
+            it++;
+    }
+
+    if (!dropped.empty())
+        LOG(MEMORY, "Buffer cache released %lu idle buffers", dropped.size());
+}
+
+size_t VPUBufferCache::getCachedSize() const {
+    const std::lock_guard<std::mutex> lock(mtx);
+    return cachedSize;
+}
+
+size_t VPUBufferCache::getCachedCount() const {
+    const std::lock_guard<std::mutex> lock(mtx);
+    return cachedCount;
+}
+
+uint64_t VPUBufferCache::getHitCount() const {
+    const std::lock_guard<std::mutex> lock(mtx);
+    return hitCount;
+}
+
+uint64_t VPUBufferCache::getMissCount() const {
+    const std::lock_guard<std::mutex> lock(mtx);
+    return missCount;
+}
+
+VPUBufferCounters::Usage VPUBufferCache::getUsage() const {
+    const std::lock_guard<std::mutex> lock(mtx);
+    return {cachedSize, cachedCount, peakCachedSize, peakCachedCount};
+}
+
+} // namespace VPU
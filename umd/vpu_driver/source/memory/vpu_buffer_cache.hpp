@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vpu_driver/source/memory/vpu_buffer_counters.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace VPU {
+
+/**
+ * Recycling pool for internal buffer objects.
+ *
+ * Released buffer objects are kept created and mapped, bucketed by type and page aligned size,
+ * so the next request for the same size class skips the create/mmap/munmap/close round trip.
+ * The pool is bounded by a byte cap and entries that stay unused for longer than the idle
+ * timeout are released back to the kernel driver. Buffers kept in the pool are not included in
+ * the context buffer counters, the pool reports its own usage.
+ */
+class VPUBufferCache {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t defaultMaxSize = 64 * 1024 * 1024;
+    static constexpr Clock::duration defaultIdleTimeout = std::chrono::seconds(2);
+
+    VPUBufferCache(size_t maxSize, Clock::duration idleTimeout = defaultIdleTimeout);
+    ~VPUBufferCache() = default;
+
+    VPUBufferCache(VPUBufferCache const &) = delete;
+    VPUBufferCache &operator=(VPUBufferCache const &) = delete;
+
+    /**
+     * Return cache size limit, ZE_INTEL_NPU_BO_CACHE_SIZE overrides the default value.
+     * Setting the limit to 0 disables the cache.
+     */
+    static size_t getMaxSizeFromEnv();
+
+    /**
+     * Only mappable types are recycled, reused buffers are cleared through CPU mapping.
+     */
+    static bool isCacheable(VPUBufferObject::Type type) {
+        return static_cast<uint32_t>(type) & DRM_IVPU_BO_MAPPABLE;
+    }
+
+    /**
+       Take a buffer object of given type and page aligned size from the pool.
+       @return pointer to VPUBufferObject, nullptr when the size class is empty
+     */
+    std::shared_ptr<VPUBufferObject> acquire(VPUBufferObject::Type type, size_t alignedSize);
+
+    /**
+       Return buffer object to the pool.
+       @return true when buffer is kept in the pool, false when it has been dropped
+     */
+    bool release(std::shared_ptr<VPUBufferObject> bo);
+
+    /**
+     * Release buffer objects that have not been used for the idle timeout. The pool is swept at
+     * most once per idle period, acquire and release do the same on the way.
+     */
+    void trim();
+
+    /**
+     * Release all buffer objects kept in the pool, used when the kernel driver fails to allocate
+     */
+    void clear();
+
+    bool isEnabled() const { return maxSize > 0; }
+    size_t getMaxSize() const { return maxSize; }
+    size_t getCachedSize() const;
+    size_t getCachedCount() const;
+    uint64_t getHitCount() const;
+    uint64_t getMissCount() const;
+    VPUBufferCounters::Usage getUsage() const;
+
+  private:
+    using Key = std::pair<VPUBufferObject::Type, size_t>;
+    struct Entry {
+        std::shared_ptr<VPUBufferObject> bo;
+        Clock::time_point releaseTime;
+    };
+
+    void trimLocked(Clock::time_point now, std::vector<std::shared_ptr<VPUBufferObject>> &dropped);
+
+    const size_t maxSize;
+    const Clock::duration idleTimeout;
+
+    std::map<Key, std::vector<Entry>> entries;
+    size_t cachedSize = 0;
+    size_t cachedCount = 0;
+    size_t peakCachedSize = 0;
+    size_t peakCachedCount = 0;
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    Clock::time_point lastTrim;
+    mutable std::mutex mtx;
+};
+
+} // namespace VPU
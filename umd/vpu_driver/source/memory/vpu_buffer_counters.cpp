@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "vpu_driver/source/memory/vpu_buffer_counters.hpp"
+
+namespace VPU {
+
+static void updatePeak(std::atomic<uint64_t> &peak, uint64_t value) {
+    uint64_t current = peak.load(std::memory_order_relaxed);
+    while (current < value &&
+           !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void VPUBufferCounters::Counter::add(uint64_t bytes) {
+    updatePeak(peakSize, size.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    updatePeak(peakCount, count.fetch_add(1, std::memory_order_relaxed) + 1);
+}
+
+void VPUBufferCounters::Counter::remove(uint64_t bytes) {
+    size.fetch_sub(bytes, std::memory_order_relaxed);
+    count.fetch_sub(1, std::memory_order_relaxed);
+}
+
+VPUBufferCounters::Usage VPUBufferCounters::Counter::get() const {
+    Usage usage;
+    usage.size = size.load(std::memory_order_relaxed);
+    usage.count = count.load(std::memory_order_relaxed);
+    usage.peakSize = peakSize.load(std::memory_order_relaxed);
+    usage.peakCount = peakCount.load(std::memory_order_relaxed);
+    return usage;
+}
+
+VPUBufferCounters::LocationIndex
+VPUBufferCounters::getLocationIndex(VPUBufferObject::Location location) {
+    switch (location) {
+    case VPUBufferObject::Location::Host:
+    case VPUBufferObject::Location::ExternalHost:
+        return LOCATION_HOST;
+    case VPUBufferObject::Location::Device:
+    case VPUBufferObject::Location::ExternalDevice:
+        return LOCATION_DEVICE;
+    case VPUBufferObject::Location::Shared:
+    case VPUBufferObject::Location::ExternalShared:
+        return LOCATION_SHARED;
+    case VPUBufferObject::Location::Internal:
+    default:
+        return LOCATION_INTERNAL;
+    }
+}
+
+VPUBufferCounters::TypeIndex VPUBufferCounters::getTypeIndex(VPUBufferObject::Type type) {
+    switch (type) {
+    case VPUBufferObject::Type::CachedFw:
+        return TYPE_CACHED_FW;
+    case VPUBufferObject::Type::CachedShave:
+        return TYPE_CACHED_SHAVE;
+    case VPUBufferObject::Type::CachedDma:
+        return TYPE_CACHED_DMA;
+    case VPUBufferObject::Type::UncachedFw:
+        return TYPE_UNCACHED_FW;
+    case VPUBufferObject::Type::UncachedShave:
+        return TYPE_UNCACHED_SHAVE;
+    case VPUBufferObject::Type::UncachedDma:
+        return TYPE_UNCACHED_DMA;
+    case VPUBufferObject::Type::WriteCombineFw:
+        return TYPE_WRITE_COMBINE_FW;
+    case VPUBufferObject::Type::WriteCombineShave:
+        return TYPE_WRITE_COMBINE_SHAVE;
+    case VPUBufferObject::Type::WriteCombineDma:
+        return TYPE_WRITE_COMBINE_DMA;
+    case VPUBufferObject::Type::ImportedMemory:
+    default:
+        return TYPE_IMPORTED_MEMORY;
+    }
+}
+
+void VPUBufferCounters::add(const VPUBufferObject &bo) {
+    total.add(bo.getAllocSize());
+    byLocation[getLocationIndex(bo.getLocation())].add(bo.getAllocSize());
+    byType[getTypeIndex(bo.getType())].add(bo.getAllocSize());
+}
+
+void VPUBufferCounters::remove(const VPUBufferObject &bo) {
+    total.remove(bo.getAllocSize());
+    byLocation[getLocationIndex(bo.getLocation())].remove(bo.getAllocSize());
+    byType[getTypeIndex(bo.getType())].remove(bo.getAllocSize());
+}
+
+} // namespace VPU
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+
+#include <array>
+#include <atomic>
+
+namespace VPU {
+
+/**
+ * Buffer object accounting maintained on create and destroy, queries are O(1) and lock-free.
+ * Every counter keeps current value and high-water mark of allocated bytes and buffer count.
+ */
+class VPUBufferCounters {
+  public:
+    struct Usage {
+        uint64_t size = 0;
+        uint64_t count = 0;
+        uint64_t peakSize = 0;
+        uint64_t peakCount = 0;
+    };
+
+    // External locations are accounted together with their non-external counterparts
+    enum LocationIndex : size_t {
+        LOCATION_INTERNAL = 0,
+        LOCATION_HOST,
+        LOCATION_DEVICE,
+        LOCATION_SHARED,
+        LOCATION_COUNT,
+    };
+
+    enum TypeIndex : size_t {
+        TYPE_CACHED_FW = 0,
+        TYPE_CACHED_SHAVE,
+        TYPE_CACHED_DMA,
+        TYPE_UNCACHED_FW,
+        TYPE_UNCACHED_SHAVE,
+        TYPE_UNCACHED_DMA,
+        TYPE_WRITE_COMBINE_FW,
+        TYPE_WRITE_COMBINE_SHAVE,
+        TYPE_WRITE_COMBINE_DMA,
+        TYPE_IMPORTED_MEMORY,
+        TYPE_COUNT,
+    };
+
+    static LocationIndex getLocationIndex(VPUBufferObject::Location location);
+    static TypeIndex getTypeIndex(VPUBufferObject::Type type);
+
+    void add(const VPUBufferObject &bo);
+    void remove(const VPUBufferObject &bo);
+
+    Usage getTotal() const { return total.get(); }
+    Usage getByLocation(LocationIndex index) const { return byLocation[index].get(); }
+    Usage getByType(TypeIndex index) const { return byType[index].get(); }
+
+  private:
+    struct Counter {
+        std::atomic<uint64_t> size{0};
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> peakSize{0};
+        std::atomic<uint64_t> peakCount{0};
+
+        void add(uint64_t bytes);
+        void remove(uint64_t bytes);
+        Usage get() const;
+    };
+
+    Counter total;
+    std::array<Counter, LOCATION_COUNT> byLocation;
+    std::array<Counter, TYPE_COUNT> byType;
+};
+
+} // namespace VPU
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "vpu_driver/source/memory/vpu_buffer_index.hpp"
+
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <utility>
+
+namespace VPU {
+
+static size_t getReaderSlot() {
+    static std::atomic<size_t> nextSlot{0};
+    static thread_local size_t slot = nextSlot.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+VPUBufferIndex::VPUBufferIndex()
+    : snapshot(new Snapshot()) {}
+
+VPUBufferIndex::~VPUBufferIndex() {
+    delete snapshot.load();
+}
+
+size_t VPUBufferIndex::readLock() const {
+    auto &slot = readers[getReaderSlot() % readerSlots];
+    while (true) {
+        uint64_t gen = generation.load();
+        size_t parity = gen & 1;
+        slot.count[parity].fetch_add(1);
+        // Writer might have flipped the generation before the counter has been incremented
+        if (generation.load() == gen)
+            return parity;
+        slot.count[parity].fetch_sub(1);
+    }
+}
+
+void VPUBufferIndex::readUnlock(size_t token) const {
+    readers[getReaderSlot() % readerSlots].count[token].fetch_sub(1);
+}
+
+void VPUBufferIndex::synchronize() {
+    // Two flips guarantee that readers registered in either parity have left the section. Read
+    // sections are a binary search, so the writer spins briefly before it yields.
+    for (int i = 0; i < 2; i++) {
+        uint64_t parity = generation.fetch_add(1) & 1;
+        for (auto &slot : readers) {
+            for (size_t spin = 0; slot.count[parity].load() != 0; spin++) {
+                if (spin >= 64)
+                    std::this_thread::yield();
+            }
+        }
+    }
+}
+
+void VPUBufferIndex::publish(Snapshot *newSnapshot) {
+    Snapshot *oldSnapshot = snapshot.exchange(newSnapshot);
+    synchronize();
+    delete oldSnapshot;
+}
+
+bool VPUBufferIndex::insert(std::shared_ptr<VPUBufferObject> bo) {
+    const uint8_t *begin = bo->getBasePointer();
+    const uint8_t *end = begin + bo->getAllocSize();
+
+    const std::lock_guard<std::mutex> lock(writeMtx);
+    const Snapshot *current = snapshot.load();
+    auto it = std::upper_bound(current->begin(), current->end(), begin, isBefore);
+    if (it != current->begin() && std::prev(it)->begin == begin)
+        return false;
+
+    auto *newSnapshot = new Snapshot();
+    newSnapshot->reserve(current->size() + 1);
+    newSnapshot->insert(newSnapshot->end(), current->begin(), it);
+    newSnapshot->push_back({begin, end, std::move(bo)});
+    newSnapshot->insert(newSnapshot->end(), it, current->end());
+    publish(newSnapshot);
+    return true;
+}
+
+std::shared_ptr<VPUBufferObject> VPUBufferIndex::erase(const void *basePtr) {
+    const uint8_t *begin = static_cast<const uint8_t *>(basePtr);
+
+    const std::lock_guard<std::mutex> lock(writeMtx);
+    const Snapshot *current = snapshot.load();
+    auto it = std::upper_bound(current->begin(), current->end(), begin, isBefore);
+    if (it == current->begin() || std::prev(it)->begin != begin)
+        return nullptr;
+    --it;
+
+    auto bo = it->bo;
+    auto *newSnapshot = new Snapshot();
+    newSnapshot->reserve(current->size() - 1);
+    newSnapshot->insert(newSnapshot->end(), current->begin(), it);
+    newSnapshot->insert(newSnapshot->end(), it + 1, current->end());
+    publish(newSnapshot);
+    return bo;
+}
+
+std::shared_ptr<VPUBufferObject> VPUBufferIndex::find(const void *ptr) const {
+    const uint8_t *bytePtr = static_cast<const uint8_t *>(ptr);
+    std::shared_ptr<VPUBufferObject> bo = nullptr;
+
+    size_t token = readLock();
+    const Snapshot *current = snapshot.load();
+    auto it = std::upper_bound(current->begin(), current->end(), bytePtr, isBefore);
+    if (it != current->begin()) {
+        --it;
+        if (bytePtr < it->end)
+            bo = it->bo;
+    }
+    readUnlock(token);
+
+    return bo;
+}
+
+size_t VPUBufferIndex::size() const {
+    size_t token = readLock();
+    size_t count = snapshot.load()->size();
+    readUnlock(token);
+    return count;
+}
+
+} // namespace VPU
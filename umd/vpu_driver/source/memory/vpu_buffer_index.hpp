@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace VPU {
+class VPUBufferObject;
+
+/**
+ * Read-mostly index of tracked buffer objects, keyed by the CPU address range.
+ *
+ * Lookups do not take any lock. The index is a sorted array of address ranges that is replaced
+ * as a whole on every update (RCU-style copy-on-write). Readers announce themselves in striped
+ * per-thread counters and writers wait for a grace period before the previous array is freed.
+ * Updates are serialized by the index and cost O(n), lookups are O(log n).
+ *
+ * The index owns the references to tracked buffer objects.
+ */
+class VPUBufferIndex {
+  public:
+    VPUBufferIndex();
+    ~VPUBufferIndex();
+
+    VPUBufferIndex(const VPUBufferIndex &) = delete;
+    VPUBufferIndex &operator=(const VPUBufferIndex &) = delete;
+
+    /**
+       Add buffer object to the index.
+       @return false when buffer object with the same base pointer is already in the index
+     */
+    bool insert(std::shared_ptr<VPUBufferObject> bo);
+
+    /**
+       Remove buffer object with given base pointer from the index. When the function returns
+       no reader is referencing the removed entry any more.
+       @return removed buffer object, nullptr if base pointer is not in the index
+     */
+    std::shared_ptr<VPUBufferObject> erase(const void *basePtr);
+
+    /**
+       Find buffer object that contains given pointer.
+       @return pointer to VPUBufferObject, nullptr if pointer is not in any buffer object
+     */
+    std::shared_ptr<VPUBufferObject> find(const void *ptr) const;
+
+    size_t size() const;
+
+  private:
+    struct Entry {
+        const uint8_t *begin;
+        const uint8_t *end;
+        std::shared_ptr<VPUBufferObject> bo;
+    };
+    using Snapshot = std::vector<Entry>;
+
+    static bool isBefore(const uint8_t *ptr, const Entry &entry) { return ptr < entry.begin; }
+
+    static constexpr size_t readerSlots = 16;
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> count[2] = {};
+    };
+
+    size_t readLock() const;
+    void readUnlock(size_t token) const;
+    void publish(Snapshot *newSnapshot);
+    void synchronize();
+
+    std::atomic<Snapshot *> snapshot;
+    std::atomic<uint64_t> generation{0};
+    mutable std::array<ReaderSlot, readerSlots> readers = {};
+    std::mutex writeMtx;
+};
+
+} // namespace VPU
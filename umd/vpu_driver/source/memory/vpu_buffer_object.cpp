@@ -8,11 +8,13 @@
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 
 #include "umd_common.hpp"
+#include "vpu_driver/source/memory/vpu_streaming_copy.hpp"
 #include "vpu_driver/source/os_interface/vpu_driver_api.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 #include "vpu_driver/source/utilities/stats.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <fcntl.h>
 #include <string.h>
 #include <sys/types.h>
@@ -20,26 +22,52 @@
 
 namespace VPU {
 
+/*
+ * MAP_POPULATE does not fault in PFN mappings of GEM objects, so every page is touched instead.
+ * Newly created buffer is zeroed by the kernel, writing zero keeps the content.
+ */
+static void prefault(const VPUDriverApi &drvApi, void *ptr, size_t size) {
+    auto start = std::chrono::steady_clock::now();
+
+    volatile uint8_t *bytePtr = static_cast<volatile uint8_t *>(ptr);
+    const size_t pageSize = drvApi.getPageSize();
+    for (size_t offset = 0; offset < size; offset += pageSize)
+        bytePtr[offset] = 0;
+
+    auto time = std::chrono::steady_clock::now() - start;
+    MemoryStatistics::get().addPrefault(size, time);
+    LOG(MEMORY,
+        "Prefaulted buffer %p, size: %lu, time: %ld us",
+        ptr,
+        size,
+        std::chrono::duration_cast<std::chrono::microseconds>(time).count());
+}
+
 VPUBufferObject::VPUBufferObject(const VPUDriverApi &drvApi,
                                  Location location,
                                  Type type,
                                  void *basePtr,
                                  size_t allocSize,
                                  uint32_t handle,
-                                 uint64_t vpuAddr)
+                                 uint64_t vpuAddr,
+                                 Mapping mapping,
+                                 uint64_t mmapOffset)
     : drvApi(drvApi)
     , location(location)
     , type(type)
     , basePtr(static_cast<uint8_t *>(basePtr))
     , allocSize(allocSize)
     , vpuAddr(vpuAddr)
-    , handle(handle) {
+    , handle(handle)
+    , mapping(mapping)
+    , mmapOffset(mmapOffset) {
     static uint64_t counter = 0;
     id = ++counter;
 }
 
 VPUBufferObject::~VPUBufferObject() {
-    if (drvApi.unmap(basePtr, allocSize) != 0) {
+    uint8_t *ptr = basePtr.load();
+    if (ptr != nullptr && drvApi.unmap(ptr, allocSize) != 0) {
         LOG_E("Failed to unmap handle %d", handle);
     }
 
@@ -59,8 +87,11 @@ VPUBufferObject::~VPUBufferObject() {
     }
 }
 
-std::shared_ptr<VPUBufferObject>
-VPUBufferObject::create(const VPUDriverApi &drvApi, Location type, Type range, size_t size) {
+std::shared_ptr<VPUBufferObject> VPUBufferObject::create(const VPUDriverApi &drvApi,
+                                                         Location type,
+                                                         Type range,
+                                                         size_t size,
+                                                         Mapping mapping) {
     uint32_t handle = 0;
     uint64_t vpuAddr = 0;
     if (drvApi.createBuffer(size, static_cast<uint32_t>(range), handle, vpuAddr)) {
@@ -68,7 +99,6 @@ VPUBufferObject::create(const VPUDriverApi &drvApi, Location type, Type range, s
         return nullptr;
     }
 
-    void *ptr = nullptr;
     uint64_t offset = 0;
     if (drvApi.getBufferInfo(handle, offset)) {
         LOG_E("Failed to get info about buffer");
@@ -76,25 +106,35 @@ VPUBufferObject::create(const VPUDriverApi &drvApi, Location type, Type range, s
         return nullptr;
     }
 
-    ptr = drvApi.mmap(size, safe_cast<off_t>(offset));
+    if (MemoryStatistics::get().isEnabled()) {
+        size_t pageSize = drvApi.getPageSize();
+        MemoryStatistics::get().inc(type, ALIGN(size, pageSize));
+    }
+
+    auto bo = std::make_shared<VPUBufferObject>(drvApi,
+                                                type,
+                                                range,
+                                                nullptr,
+                                                size,
+                                                handle,
+                                                vpuAddr,
+                                                mapping,
+                                                offset);
+    if (mapping == Mapping::Lazy)
+        return bo;
+
+    uint8_t *ptr = bo->getBasePointer();
     if (ptr == nullptr) {
         LOG_E("Failed to mmap the created buffer");
-        drvApi.closeBuffer(handle);
+        // Handle is not exported yet, it has to be closed together with the buffer object
+        bo->allowDeleteExternalHandle();
         return nullptr;
     }
 
-    if (MemoryStatistics::get().isEnabled()) {
-        size_t pageSize = drvApi.getPageSize();
-        MemoryStatistics::get().inc(type, ALIGN(size, pageSize));
-    }
+    if (mapping == Mapping::Populate)
+        prefault(drvApi, ptr, size);
 
-    return std::make_shared<VPUBufferObject>(drvApi,
-                                             type,
-                                             range,
-                                             std::move(ptr),
-                                             size,
-                                             handle,
-                                             vpuAddr);
+    return bo;
 }
 
 std::shared_ptr<VPUBufferObject>
@@ -139,6 +179,23 @@ VPUBufferObject::importFromFd(const VPUDriverApi &drvApi, Location type, int32_t
                                              vpuAddr);
 }
 
+uint8_t *VPUBufferObject::map() const {
+    const std::lock_guard<std::mutex> lock(mapMtx);
+    uint8_t *ptr = basePtr.load(std::memory_order_relaxed);
+    if (ptr != nullptr)
+        return ptr;
+
+    ptr = static_cast<uint8_t *>(drvApi.mmap(allocSize, safe_cast<off_t>(mmapOffset)));
+    if (ptr == nullptr) {
+        LOG_E("Failed to mmap the buffer object, handle %u", handle);
+        return nullptr;
+    }
+
+    LOG(MEMORY, "Mapped buffer object, handle %u, cpu: %p", handle, ptr);
+    basePtr.store(ptr, std::memory_order_release);
+    return ptr;
+}
+
 bool VPUBufferObject::copyToBuffer(const void *data, size_t size, uint64_t offset) {
     if ((offset + size) > allocSize) {
         LOG_E("Copy out of buffer range");
@@ -150,8 +207,15 @@ bool VPUBufferObject::copyToBuffer(const void *data, size_t size, uint64_t offse
         return false;
     }
 
-    uint8_t *dstPtr = basePtr + offset;
-    memcpy(dstPtr, data, size);
+    uint8_t *cpuPtr = getBasePointer();
+    if (cpuPtr == nullptr)
+        return false;
+
+    uint8_t *dstPtr = cpuPtr + offset;
+    if (isWriteCombined())
+        streamingCopy(dstPtr, data, size);
+    else
+        memcpy(dstPtr, data, size);
     return true;
 }
 
@@ -161,9 +225,23 @@ bool VPUBufferObject::fillBuffer(const void *pattern, size_t patternSize) {
         return false;
     }
 
+    uint8_t *cpuPtr = getBasePointer();
+    if (cpuPtr == nullptr)
+        return false;
+
+    if (isWriteCombined()) {
+        if (patternSize != sizeof(uint32_t) && patternSize != sizeof(uint16_t) &&
+            patternSize != sizeof(uint8_t)) {
+            LOG_E("Unsupported pattern size");
+            return false;
+        }
+        streamingFill(cpuPtr, pattern, patternSize, allocSize - allocSize % patternSize);
+        return true;
+    }
+
     switch (patternSize) {
     case sizeof(uint32_t): {
-        uint32_t *start = reinterpret_cast<uint32_t *>(basePtr);
+        uint32_t *start = reinterpret_cast<uint32_t *>(cpuPtr);
         uint32_t *end = start + (allocSize / sizeof(uint32_t));
 
         std::fill(start, end, *reinterpret_cast<const uint32_t *>(pattern));
@@ -171,7 +249,7 @@ bool VPUBufferObject::fillBuffer(const void *pattern, size_t patternSize) {
     }
 
     case sizeof(uint16_t): {
-        uint16_t *start = reinterpret_cast<uint16_t *>(basePtr);
+        uint16_t *start = reinterpret_cast<uint16_t *>(cpuPtr);
         uint16_t *end = start + (allocSize / sizeof(uint16_t));
 
         std::fill(start, end, *reinterpret_cast<const uint16_t *>(pattern));
@@ -179,9 +257,7 @@ bool VPUBufferObject::fillBuffer(const void *pattern, size_t patternSize) {
     }
 
     case sizeof(uint8_t):
-        memset(reinterpret_cast<uint8_t *>(basePtr),
-               *static_cast<const uint8_t *>(pattern),
-               allocSize);
+        memset(cpuPtr, *static_cast<const uint8_t *>(pattern), allocSize);
         break;
     default:
         LOG_E("Unsupported pattern size");
@@ -10,7 +10,9 @@
 #include <cstddef>
 #include <cstdint>
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <uapi/drm/ivpu_accel.h>
 
 namespace VPU {
@@ -41,8 +43,22 @@ class VPUBufferObject {
         ExternalShared = 0x8008,
     };
 
-    static std::shared_ptr<VPUBufferObject>
-    create(const VPUDriverApi &drvApi, Location type, Type range, size_t size);
+    /**
+      CPU mapping mode. Lazily mapped buffer object is mapped on first CPU access, buffer object
+      that is only accessed by VPU is never mapped. Populated buffer object is mapped and
+      pre-faulted at creation, the first host access does not take page faults.
+     */
+    enum class Mapping {
+        Immediate,
+        Lazy,
+        Populate,
+    };
+
+    static std::shared_ptr<VPUBufferObject> create(const VPUDriverApi &drvApi,
+                                                   Location type,
+                                                   Type range,
+                                                   size_t size,
+                                                   Mapping mapping = Mapping::Immediate);
 
     /**
      * @brief Import Buffer from file descriptor
@@ -57,7 +73,9 @@ class VPUBufferObject {
                     void *basePtr,
                     size_t allocSize,
                     uint32_t handle,
-                    uint64_t vpuAddr);
+                    uint64_t vpuAddr,
+                    Mapping mapping = Mapping::Immediate,
+                    uint64_t mmapOffset = 0);
     ~VPUBufferObject();
 
     VPUBufferObject(const VPUBufferObject &) = delete;
@@ -75,6 +93,14 @@ class VPUBufferObject {
      */
     Type getType() const { return type; }
 
+    /**
+      Returns whether the CPU mapping is write-combined, such memory is written with streaming
+      stores and it should never be read by CPU.
+     */
+    bool isWriteCombined() const {
+        return (static_cast<uint32_t>(type) & DRM_IVPU_BO_CACHE_MASK) == DRM_IVPU_BO_WC;
+    }
+
     void allowDeleteExternalHandle() {
         switch (location) {
         case Location::ExternalHost:
@@ -102,19 +128,29 @@ class VPUBufferObject {
     uint32_t getHandle() const { return handle; }
 
     /**
-      Returns buffer object's virtual address.
+      Returns buffer object's virtual address. Lazily mapped buffer object is mapped by the call.
+      @return CPU address, nullptr if the mapping failed
+     */
+    uint8_t *getBasePointer() const {
+        uint8_t *ptr = basePtr.load(std::memory_order_acquire);
+        return ptr != nullptr ? ptr : map();
+    }
+
+    Mapping getMapping() const { return mapping; }
+
+    /**
+      Returns whether the buffer object has been mapped to CPU address space.
      */
-    uint8_t *getBasePointer() const { return basePtr; }
+    bool isMapped() const { return basePtr.load(std::memory_order_acquire) != nullptr; }
 
     /**
       Returns whether the given pointer is within buffer object's range or not.
       @param ptr[IN]: Pointer to check.
-      @return true if given ptr is in range from basePtr to basePtr + allocSize - 1.
+      @return true if given ptr is in range from user pointer to user pointer + allocSize - 1.
      */
     bool isInRange(const void *ptr) const {
-        // Byte wise pointer arithmetic.
-        uint8_t *upperBound = basePtr + allocSize;
-        return ptr >= basePtr && ptr < upperBound;
+        uint64_t offset = 0;
+        return getOffset(ptr, offset);
     }
 
     /**
@@ -126,16 +162,14 @@ class VPUBufferObject {
        Returns VPU address related to ptr in host address space.
      */
     uint64_t getVPUAddr(const void *ptr) const {
-        if (!isInRange(ptr))
+        uint64_t offset = 0;
+        if (!getOffset(ptr, offset))
             return 0;
-        const uint64_t offset =
-            reinterpret_cast<uint64_t>(ptr) - reinterpret_cast<uint64_t>(basePtr);
         return vpuAddr + offset;
     }
 
     /**
-       Copy data to the allocated buffer.
-       Member variable appendOffset will be maintained internally.
+       Copy data to the allocated buffer. Write-combined buffer is written with streaming stores.
        @param dataSrc[in]: Byte stream data to copy.
        @param dataSize[in]: Size of the stream in bytes.
        @return true on successful copy, false otherwise.
@@ -143,7 +177,7 @@ class VPUBufferObject {
     bool copyToBuffer(const void *data, size_t size, uint64_t offset);
 
     /**
-       Fill allocated buffer with pattern.
+       Fill allocated buffer with pattern. Write-combined buffer is written with streaming stores.
        @param pattern[in]: Pattern byte stream.
        @param patternSize[in]: Size of pattern, allowed:1,2,4
        @return true on successful fill, false otherwise.
@@ -158,15 +192,30 @@ class VPUBufferObject {
     uint64_t getId() const { return id; }
 
   private:
+    uint8_t *map() const;
+
+    // Buffer object that is not mapped yet does not contain any CPU address
+    bool getOffset(const void *ptr, uint64_t &offset) const {
+        const uint64_t addr = reinterpret_cast<uint64_t>(ptr);
+        const uint64_t base = reinterpret_cast<uint64_t>(basePtr.load(std::memory_order_acquire));
+        if (base == 0 || addr < base || addr - base >= allocSize)
+            return false;
+        offset = addr - base;
+        return true;
+    }
+
     const VPUDriverApi &drvApi;
     Location location;
     Type type;
-    uint8_t *basePtr;
+    mutable std::atomic<uint8_t *> basePtr;
+    mutable std::mutex mapMtx;
     size_t allocSize;
 
     uint64_t vpuAddr;
     uint32_t handle;
     uint64_t id;
+    Mapping mapping;
+    uint64_t mmapOffset;
 };
 
 } // namespace VPU
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "vpu_driver/source/memory/vpu_shared_buffers.hpp"
+
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace VPU {
+
+HashSha256::Digest VPUSharedBuffers::hashChunk(const void *chunk, size_t size) {
+    return HashSha256::getDigest(chunk, size);
+}
+
+HashSha256::Digest
+VPUSharedBuffers::combineHashes(const std::vector<HashSha256::Digest> &chunkHashes) {
+    HashSha256 hash;
+    for (const auto &chunkHash : chunkHashes)
+        hash.update(chunkHash.data(), chunkHash.size());
+    return hash.final();
+}
+
+VPUSharedBuffers::Key
+VPUSharedBuffers::makeKey(const void *data, size_t size, uint64_t attributes) {
+    const uint8_t *content = static_cast<const uint8_t *>(data);
+    std::vector<HashSha256::Digest> chunkHashes;
+    for (size_t offset = 0; offset < size; offset += hashChunkSize)
+        chunkHashes.push_back(
+            hashChunk(content + offset, std::min(hashChunkSize, size - offset)));
+    return {combineHashes(chunkHashes), size, attributes};
+}
+
+std::shared_ptr<VPUBufferObject> VPUSharedBuffers::reuse(std::shared_ptr<VPUBufferObject> bo) {
+    size_t size = bo->getAllocSize();
+    *savedSize += size;
+
+    // Aliasing pointer keeps the buffer object and returns its size when the user drops it
+    auto *ptr = bo.get();
+    return std::shared_ptr<VPUBufferObject>(
+        ptr,
+        [owner = std::move(bo), saved = savedSize, size](VPUBufferObject *) mutable {
+            *saved -= size;
+            owner.reset();
+        });
+}
+
+void VPUSharedBuffers::prune() {
+    for (auto it = buffers.begin(); it != buffers.end();) {
+        if (it->second.expired())
+            it = buffers.erase(it);
+        else
+            it++;
+    }
+}
+
+std::shared_ptr<VPUBufferObject> VPUSharedBuffers::find(const Key &key) {
+    const std::lock_guard<std::mutex> lock(mtx);
+    auto it = buffers.find(key);
+    if (it == buffers.end())
+        return nullptr;
+
+    auto bo = it->second.lock();
+    if (bo == nullptr) {
+        buffers.erase(it);
+        return nullptr;
+    }
+
+    LOG(MEMORY, "Reusing shared buffer %p, size: %lu", bo->getBasePointer(), key.size);
+    return reuse(std::move(bo));
+}
+
+std::shared_ptr<VPUBufferObject> VPUSharedBuffers::add(const Key &key,
+                                                       std::shared_ptr<VPUBufferObject> bo) {
+    const std::lock_guard<std::mutex> lock(mtx);
+    auto &entry = buffers[key];
+    if (auto published = entry.lock())
+        return reuse(std::move(published));
+
+    entry = bo;
+    prune();
+    return bo;
+}
+
+VPUSharedBuffers::Stats VPUSharedBuffers::getStats() {
+    Stats stats;
+    const std::lock_guard<std::mutex> lock(mtx);
+    for (const auto &[key, weakBo] : buffers) {
+        if (auto bo = weakBo.lock()) {
+            stats.count++;
+            stats.size += bo->getAllocSize();
+        }
+    }
+    stats.savedSize = savedSize->load();
+    return stats;
+}
+
+} // namespace VPU
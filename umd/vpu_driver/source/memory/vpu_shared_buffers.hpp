@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vpu_driver/source/utilities/sha256.hpp"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace VPU {
+class VPUBufferObject;
+
+/**
+ * Content addressed registry of buffer objects that are never written after upload, e.g. read
+ * only sections of graphs. Users that upload the same content get the same buffer object.
+ *
+ * Registry keeps weak references, buffer object is released with its last user. Buffers handed
+ * out by find() count as saved memory until all their references are dropped.
+ */
+class VPUSharedBuffers {
+  public:
+    struct Key {
+        HashSha256::Digest hash;
+        size_t size;
+        // Any user defined attributes that make buffers incompatible, e.g. buffer type
+        uint64_t attributes;
+
+        bool operator<(const Key &other) const {
+            return std::tie(hash, size, attributes) <
+                   std::tie(other.hash, other.size, other.attributes);
+        }
+    };
+
+    struct Stats {
+        // Buffer objects currently shared
+        uint64_t count = 0;
+        uint64_t size = 0;
+        // Size of buffer objects that users would have allocated without sharing
+        uint64_t savedSize = 0;
+    };
+
+    VPUSharedBuffers() = default;
+    ~VPUSharedBuffers() = default;
+
+    VPUSharedBuffers(VPUSharedBuffers const &) = delete;
+    VPUSharedBuffers &operator=(VPUSharedBuffers const &) = delete;
+
+    // Content is hashed in parts of this size, users that read the content in parts hash every
+    // part with hashChunk and combine the part hashes in order to get the same key as makeKey.
+    // Parts may be hashed in any order, e.g. on several threads. Content is identified by
+    // SHA-256, the buffers are never read back to compare the content.
+    static constexpr size_t hashChunkSize = 1024 * 1024;
+
+    static HashSha256::Digest hashChunk(const void *chunk, size_t size);
+    static HashSha256::Digest combineHashes(const std::vector<HashSha256::Digest> &chunkHashes);
+    static Key makeKey(const void *data, size_t size, uint64_t attributes);
+
+    /**
+       Look up buffer object with the given content.
+       @return pointer to VPUBufferObject, nullptr if there is no such buffer object
+     */
+    std::shared_ptr<VPUBufferObject> find(const Key &key);
+
+    /**
+       Publish buffer object with content described by key. If other user has published the same
+       content in the meantime, its buffer object is returned instead and counted as saved.
+     */
+    std::shared_ptr<VPUBufferObject> add(const Key &key, std::shared_ptr<VPUBufferObject> bo);
+
+    Stats getStats();
+
+  private:
+    std::shared_ptr<VPUBufferObject> reuse(std::shared_ptr<VPUBufferObject> bo);
+    void prune();
+
+    std::mutex mtx;
+    std::map<Key, std::weak_ptr<VPUBufferObject>> buffers;
+    // Shared with buffers handed out by find() that may outlive the registry
+    std::shared_ptr<std::atomic<uint64_t>> savedSize = std::make_shared<std::atomic<uint64_t>>(0);
+};
+
+} // namespace VPU
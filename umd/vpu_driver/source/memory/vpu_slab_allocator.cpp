@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "vpu_driver/source/memory/vpu_slab_allocator.hpp"
+
+#include "umd_common.hpp"
+#include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string.h>
+#include <utility>
+
+namespace VPU {
+
+VPUBufferChunk::VPUBufferChunk(std::shared_ptr<VPUBufferSlab> slab, size_t offset, size_t size)
+    : slab(std::move(slab))
+    , offset(offset)
+    , size(size) {
+    auto &bo = VPUBufferChunk::slab->getBufferObject();
+    basePtr = bo->getBasePointer() + offset;
+    vpuAddr = bo->getVPUAddr() + offset;
+}
+
+VPUBufferChunk::~VPUBufferChunk() {
+    slab->free(offset, size);
+}
+
+std::shared_ptr<VPUBufferObject> VPUBufferChunk::getBufferObject() {
+    return std::shared_ptr<VPUBufferObject>(shared_from_this(), slab->getBufferObject().get());
+}
+
+VPUBufferSlab::VPUBufferSlab(std::shared_ptr<VPUBufferObject> bo)
+    : bo(std::move(bo)) {
+    freeRanges.emplace(0, VPUBufferSlab::bo->getAllocSize());
+}
+
+bool VPUBufferSlab::allocate(size_t size, size_t &offset) {
+    const std::lock_guard<std::mutex> lock(mtx);
+    auto it = std::find_if(freeRanges.begin(), freeRanges.end(), [size](const auto &range) {
+        return range.second >= size;
+    });
+    if (it == freeRanges.end())
+        return false;
+
+    offset = it->first;
+    size_t remaining = it->second - size;
+    freeRanges.erase(it);
+    if (remaining > 0)
+        freeRanges.emplace(offset + size, remaining);
+
+    usedSize += size;
+    return true;
+}
+
+void VPUBufferSlab::free(size_t offset, size_t size) {
+    const std::lock_guard<std::mutex> lock(mtx);
+    usedSize -= size;
+
+    // Merge the range with adjacent free ranges
+    auto next = freeRanges.lower_bound(offset);
+    if (next != freeRanges.end() && offset + size == next->first) {
+        size += next->second;
+        next = freeRanges.erase(next);
+    }
+
+    if (next != freeRanges.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == offset) {
+            prev->second += size;
+            return;
+        }
+    }
+
+    freeRanges.emplace(offset, size);
+}
+
+size_t VPUBufferSlab::getUsedSize() const {
+    const std::lock_guard<std::mutex> lock(mtx);
+    return usedSize;
+}
+
+VPUSlabAllocator::VPUSlabAllocator(VPUDeviceContext *ctx)
+    : ctx(ctx) {}
+
+std::shared_ptr<VPUBufferChunk> VPUSlabAllocator::allocate(size_t size,
+                                                           VPUBufferObject::Type type) {
+    if (size == 0) {
+        LOG_E("Invalid size - %lu", size);
+        return nullptr;
+    }
+
+    size_t chunkSize = ALIGN(size, chunkAlignment);
+    std::shared_ptr<VPUBufferSlab> slab;
+    size_t offset = 0;
+
+    const std::lock_guard<std::mutex> lock(mtx);
+    auto &typeSlabs = slabs[type];
+    typeSlabs.erase(std::remove_if(typeSlabs.begin(),
+                                   typeSlabs.end(),
+                                   [](const auto &x) { return x.expired(); }),
+                    typeSlabs.end());
+
+    for (auto &weakSlab : typeSlabs) {
+        auto candidate = weakSlab.lock();
+        if (candidate && candidate->allocate(chunkSize, offset)) {
+            slab = std::move(candidate);
+            // Keep the same contract as a freshly created buffer object
+            memset(slab->getBufferObject()->getBasePointer() + offset, 0, chunkSize);
+            break;
+        }
+    }
+
+    if (slab == nullptr) {
+        // Chunks bigger than the slab size get dedicated buffer object
+        auto bo = ctx->createUntrackedBufferObject(std::max(chunkSize, slabSize), type);
+        if (bo == nullptr) {
+            LOG_E("Failed to allocate slab, size = %lu, type = %i",
+                  chunkSize,
+                  static_cast<int>(type));
+            return nullptr;
+        }
+
+        slab = std::make_shared<VPUBufferSlab>(std::move(bo));
+        if (!slab->allocate(chunkSize, offset)) {
+            LOG_E("Failed to allocate chunk from new slab");
+            return nullptr;
+        }
+        typeSlabs.emplace_back(slab);
+        LOG(MEMORY,
+            "Create slab: %p, size: %lu",
+            slab.get(),
+            slab->getBufferObject()->getAllocSize());
+    }
+
+    return std::make_shared<VPUBufferChunk>(std::move(slab), offset, chunkSize);
+}
+
+size_t VPUSlabAllocator::getSlabsCount() {
+    const std::lock_guard<std::mutex> lock(mtx);
+    size_t count = 0;
+    for (auto &typeSlabs : slabs) {
+        count += static_cast<size_t>(std::count_if(typeSlabs.second.begin(),
+                                                   typeSlabs.second.end(),
+                                                   [](const auto &x) { return !x.expired(); }));
+    }
+    return count;
+}
+
+} // namespace VPU
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace VPU {
+class VPUDeviceContext;
+class VPUBufferSlab;
+
+/**
+ * 64 bytes aligned part of a buffer object shared with other chunks of the same slab.
+ * The chunk is returned to its slab when the last reference is dropped.
+ */
+class VPUBufferChunk : public std::enable_shared_from_this<VPUBufferChunk> {
+  public:
+    VPUBufferChunk(std::shared_ptr<VPUBufferSlab> slab, size_t offset, size_t size);
+    ~VPUBufferChunk();
+
+    VPUBufferChunk(const VPUBufferChunk &) = delete;
+    VPUBufferChunk &operator=(const VPUBufferChunk &) = delete;
+
+    /**
+      Returns buffer object that holds the chunk. The returned pointer keeps the chunk alive, so
+      it can be passed to VPUCommand as the associated buffer object.
+     */
+    std::shared_ptr<VPUBufferObject> getBufferObject();
+
+    /**
+      Returns chunk's virtual address.
+     */
+    uint8_t *getBasePointer() const { return basePtr; }
+
+    /**
+      Returns chunk's VPU address.
+     */
+    uint64_t getVPUAddr() const { return vpuAddr; }
+
+    /**
+       Returns VPU address related to ptr in host address space.
+     */
+    uint64_t getVPUAddr(const void *ptr) const {
+        if (!isInRange(ptr))
+            return 0;
+        return vpuAddr + static_cast<uint64_t>(static_cast<const uint8_t *>(ptr) - basePtr);
+    }
+
+    bool isInRange(const void *ptr) const { return ptr >= basePtr && ptr < basePtr + size; }
+
+    /**
+       Returns offset of the chunk within the buffer object.
+     */
+    size_t getOffset() const { return offset; }
+
+    /**
+       Returns memory size of the chunk.
+     */
+    size_t getAllocSize() const { return size; }
+
+  private:
+    std::shared_ptr<VPUBufferSlab> slab;
+    size_t offset;
+    size_t size;
+    uint8_t *basePtr;
+    uint64_t vpuAddr;
+};
+
+/**
+ * Buffer object carved into chunks with first-fit free list.
+ */
+class VPUBufferSlab {
+  public:
+    VPUBufferSlab(std::shared_ptr<VPUBufferObject> bo);
+
+    /**
+       Reserve range of given size in the slab.
+       @return true on success, offset is set to the start of the range
+     */
+    bool allocate(size_t size, size_t &offset);
+    void free(size_t offset, size_t size);
+
+    const std::shared_ptr<VPUBufferObject> &getBufferObject() const { return bo; }
+    size_t getUsedSize() const;
+
+  private:
+    std::shared_ptr<VPUBufferObject> bo;
+    std::map<size_t, size_t> freeRanges;
+    size_t usedSize = 0;
+    mutable std::mutex mtx;
+};
+
+/**
+ * Sub-allocator for small internal buffers (events, metric queries, timestamps).
+ *
+ * Chunks are aligned to 64 bytes (FW cache line) and are carved out of shared slabs of the same
+ * buffer object type, which reduces the number of buffer objects and handles passed to submit.
+ * Slabs are held only by their chunks, a slab without live chunks is released to the device
+ * context buffer cache.
+ */
+class VPUSlabAllocator {
+  public:
+    static constexpr size_t slabSize = 64 * 1024;
+    static constexpr size_t chunkAlignment = 64;
+
+    VPUSlabAllocator(VPUDeviceContext *ctx);
+
+    VPUSlabAllocator(const VPUSlabAllocator &) = delete;
+    VPUSlabAllocator &operator=(const VPUSlabAllocator &) = delete;
+
+    /**
+       Allocate zeroed chunk of given size.
+       @return pointer to VPUBufferChunk, on failure return nullptr
+     */
+    std::shared_ptr<VPUBufferChunk> allocate(size_t size, VPUBufferObject::Type type);
+
+    /**
+     * Return number of slabs that have live chunks
+     */
+    size_t getSlabsCount();
+
+  private:
+    VPUDeviceContext *ctx;
+    std::map<VPUBufferObject::Type, std::vector<std::weak_ptr<VPUBufferSlab>>> slabs;
+    std::mutex mtx;
+};
+
+} // namespace VPU
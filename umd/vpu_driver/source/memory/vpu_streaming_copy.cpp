@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "vpu_driver/source/memory/vpu_streaming_copy.hpp"
+
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <string.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace VPU {
+
+namespace {
+
+// Below this size the fence costs more than the streaming stores save
+constexpr size_t streamingThreshold = 256;
+constexpr size_t blockSize = 64;
+
+using CopyFn = void (*)(uint8_t *dst, const uint8_t *src, size_t size);
+using FillFn = void (*)(uint8_t *dst, const uint8_t *block, size_t size);
+
+struct Kernels {
+    const char *isa;
+    CopyFn copy;
+    FillFn fill;
+};
+
+void copyGeneric(uint8_t *dst, const uint8_t *src, size_t size) {
+    memcpy(dst, src, size);
+}
+
+void fillGeneric(uint8_t *dst, const uint8_t *block, size_t size) {
+    for (; size >= blockSize; size -= blockSize, dst += blockSize)
+        memcpy(dst, block, blockSize);
+    memcpy(dst, block, size);
+}
+
+#if defined(__x86_64__)
+size_t getHeadSize(const uint8_t *dst, size_t align, size_t size) {
+    size_t head = (align - (reinterpret_cast<uintptr_t>(dst) & (align - 1))) & (align - 1);
+    return head < size ? head : size;
+}
+
+__attribute__((target("avx2"))) void copyAvx2(uint8_t *dst, const uint8_t *src, size_t size) {
+    size_t head = getHeadSize(dst, 32, size);
+    memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    size -= head;
+
+    for (; size >= 128; size -= 128, dst += 128, src += 128) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 32));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 64));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 96));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst), a);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 32), b);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 64), c);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 96), d);
+    }
+    for (; size >= 32; size -= 32, dst += 32, src += 32)
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst),
+                            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src)));
+
+    memcpy(dst, src, size);
+    _mm_sfence();
+}
+
+__attribute__((target("avx2"))) void fillAvx2(uint8_t *dst, const uint8_t *block, size_t size) {
+    size_t head = getHeadSize(dst, 32, size);
+    memcpy(dst, block, head);
+    dst += head;
+    size -= head;
+
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block));
+    for (; size >= 128; size -= 128, dst += 128) {
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst), v);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 32), v);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 64), v);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst + 96), v);
+    }
+    for (; size >= 32; size -= 32, dst += 32)
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dst), v);
+
+    memcpy(dst, block, size);
+    _mm_sfence();
+}
+
+__attribute__((target("avx512f"))) void copyAvx512(uint8_t *dst, const uint8_t *src, size_t size) {
+    size_t head = getHeadSize(dst, 64, size);
+    memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    size -= head;
+
+    for (; size >= 256; size -= 256, dst += 256, src += 256) {
+        __m512i a = _mm512_loadu_si512(src);
+        __m512i b = _mm512_loadu_si512(src + 64);
+        __m512i c = _mm512_loadu_si512(src + 128);
+        __m512i d = _mm512_loadu_si512(src + 192);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst), a);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst + 64), b);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst + 128), c);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst + 192), d);
+    }
+    for (; size >= 64; size -= 64, dst += 64, src += 64)
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst), _mm512_loadu_si512(src));
+
+    memcpy(dst, src, size);
+    _mm_sfence();
+}
+
+__attribute__((target("avx512f"))) void
+fillAvx512(uint8_t *dst, const uint8_t *block, size_t size) {
+    size_t head = getHeadSize(dst, 64, size);
+    memcpy(dst, block, head);
+    dst += head;
+    size -= head;
+
+    __m512i v = _mm512_loadu_si512(block);
+    for (; size >= 256; size -= 256, dst += 256) {
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst), v);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst + 64), v);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst + 128), v);
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst + 192), v);
+    }
+    for (; size >= 64; size -= 64, dst += 64)
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(dst), v);
+
+    memcpy(dst, block, size);
+    _mm_sfence();
+}
+#endif
+
+Kernels selectKernels() {
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return {"avx512", copyAvx512, fillAvx512};
+    if (__builtin_cpu_supports("avx2"))
+        return {"avx2", copyAvx2, fillAvx2};
+#endif
+    return {"generic", copyGeneric, fillGeneric};
+}
+
+const Kernels &getKernels() {
+    static const Kernels kernels = [] {
+        Kernels k = selectKernels();
+        LOG(MEMORY, "Streaming copy kernels: %s", k.isa);
+        return k;
+    }();
+    return kernels;
+}
+
+} // namespace
+
+void streamingCopy(void *dst, const void *src, size_t size) {
+    if (size < streamingThreshold) {
+        memcpy(dst, src, size);
+        return;
+    }
+
+    getKernels().copy(static_cast<uint8_t *>(dst), static_cast<const uint8_t *>(src), size);
+}
+
+void streamingFill(void *dst, const void *pattern, size_t patternSize, size_t size) {
+    // Pattern repeated over whole block keeps its phase as long as stores start at multiple of
+    // pattern size from the destination
+    alignas(blockSize) uint8_t block[blockSize];
+    for (size_t i = 0; i < blockSize; i += patternSize)
+        memcpy(block + i, pattern, patternSize);
+
+    if (size < streamingThreshold) {
+        fillGeneric(static_cast<uint8_t *>(dst), block, size);
+        return;
+    }
+
+    getKernels().fill(static_cast<uint8_t *>(dst), block, size);
+}
+
+} // namespace VPU
@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace VPU {
+
+/**
+ * Copy and fill kernels for write-combined memory. Streaming stores bypass CPU caches and keep
+ * write combining buffers full, the kernel is selected at runtime from AVX-512 and AVX2, and
+ * falls back to plain memcpy/memset if none of them is supported. All stores are fenced before
+ * the function returns.
+ */
+void streamingCopy(void *dst, const void *src, size_t size);
+
+/**
+ * Fill memory with pattern using streaming stores.
+ * @param dst[in]: Destination, it has to be aligned to pattern size
+ * @param pattern[in]: Pattern byte stream
+ * @param patternSize[in]: Size of pattern, allowed: 1, 2, 4
+ * @param size[in]: Size of destination in bytes, multiple of pattern size
+ */
+void streamingFill(void *dst, const void *pattern, size_t patternSize, size_t size);
+
+} // namespace VPU
@@ -22,6 +22,8 @@ class OsFile {
     virtual ~OsFile() = default;
 
     virtual bool write(const void *in, size_t size) = 0;
+    // Reads size bytes at offset without moving the file position, safe to call from many threads
+    virtual bool read(void *out, size_t size, size_t offset) = 0;
     virtual void *mmap() = 0;
     virtual size_t size() = 0;
 };
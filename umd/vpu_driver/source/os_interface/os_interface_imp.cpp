@@ -216,6 +216,30 @@ class OsFileImp : public OsFile {
         return remaining == 0;
     }
 
+    bool read(void *out, size_t size, size_t offset) override {
+        if (out == nullptr || offset > fileSize || size > fileSize - offset) {
+            LOG_E("Invalid read, size: %lu, offset: %lu, file size: %lu", size, offset, fileSize);
+            return false;
+        }
+
+        uint8_t *dst = static_cast<uint8_t *>(out);
+        while (size > 0) {
+            ssize_t ret = ::pread(fd, dst, size, safe_cast<off_t>(offset));
+            if (ret == -1 && errno == EINTR)
+                continue;
+
+            if (ret <= 0) {
+                LOG_E("Failed to read, errno: %u (%s)", errno, strerror(errno));
+                return false;
+            }
+
+            dst += ret;
+            offset += static_cast<size_t>(ret);
+            size -= static_cast<size_t>(ret);
+        }
+        return true;
+    }
+
     void *mmap() override {
         if (writeAccess) {
             LOG(FSYS, "File %d cannot be mapped in write access", fd);
@@ -160,7 +160,8 @@ int VPUDriverApi::commandQueueSubmit(const void *buffers, uint32_t bufCnt, uint3
     submitArgs.cmdq_id = queueId;
 
     int ret = doIoctl(DRM_IOCTL_IVPU_CMDQ_SUBMIT, &submitArgs);
-    if (ret)
+    // EBUSY is handled by caller with retry
+    if (ret && errno != EBUSY)
         LOG_E("DRM_IOCTL_IVPU_CMDQ_SUBMIT failed, error %d", ret);
     return ret;
 }
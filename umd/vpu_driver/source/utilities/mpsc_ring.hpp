@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace VPU {
+
+/**
+ * Bounded lock-free ring with multiple producers and a single consumer.
+ *
+ * Every slot carries a sequence number. Producers claim a position with compare and swap and
+ * publish the value by advancing the slot sequence, consumer takes values in the claim order.
+ * Capacity is rounded up to power of two.
+ */
+template <typename T>
+class MpscRing {
+  public:
+    explicit MpscRing(size_t minCapacity) {
+        size_t capacity = 2;
+        while (capacity < minCapacity)
+            capacity *= 2;
+
+        mask = capacity - 1;
+        slots = std::make_unique<Slot[]>(capacity);
+        for (size_t i = 0; i < capacity; i++)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MpscRing(const MpscRing &) = delete;
+    MpscRing &operator=(const MpscRing &) = delete;
+
+    /**
+     * Called by any producer
+     * @return false if the ring is full
+     */
+    bool tryPush(T &&value) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot &slot = slots[pos & mask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == pos) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value = std::move(value);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (sequence < pos) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Called by the consumer only
+     * @return false if there is no published value
+     */
+    bool tryPop(T &value) {
+        Slot &slot = slots[dequeuePos & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeuePos + 1)
+            return false;
+
+        value = std::move(slot.value);
+        slot.value = T();
+        slot.sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+        dequeuePos++;
+        return true;
+    }
+
+    /**
+     * Called by the consumer only
+     */
+    bool empty() const {
+        return slots[dequeuePos & mask].sequence.load(std::memory_order_acquire) != dequeuePos + 1;
+    }
+
+    size_t capacity() const { return mask + 1; }
+
+  private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask = 0;
+
+    alignas(64) std::atomic<size_t> enqueuePos = 0;
+    alignas(64) size_t dequeuePos = 0;
+};
+
+} // namespace VPU
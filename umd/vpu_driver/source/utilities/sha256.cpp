@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "vpu_driver/source/utilities/sha256.hpp"
+
+#include <algorithm>
+#include <string.h>
+
+namespace VPU {
+
+static constexpr std::array<uint32_t, 64> roundConstants = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+    0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+    0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+    0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+    0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+    0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+    0xc67178f2};
+
+static inline uint32_t rotr(uint32_t x, uint32_t n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+HashSha256::HashSha256()
+    : state({0x6a09e667,
+             0xbb67ae85,
+             0x3c6ef372,
+             0xa54ff53a,
+             0x510e527f,
+             0x9b05688c,
+             0x1f83d9ab,
+             0x5be0cd19}) {}
+
+void HashSha256::transform(const uint8_t *data) {
+    std::array<uint32_t, 64> w;
+    for (size_t i = 0; i < 16; i++)
+        w[i] = static_cast<uint32_t>(data[i * 4]) << 24 |
+               static_cast<uint32_t>(data[i * 4 + 1]) << 16 |
+               static_cast<uint32_t>(data[i * 4 + 2]) << 8 | static_cast<uint32_t>(data[i * 4 + 3]);
+    for (size_t i = 16; i < 64; i++) {
+        uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    auto [a, b, c, d, e, f, g, h] = state;
+    for (size_t i = 0; i < 64; i++) {
+        uint32_t s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+        uint32_t ch = (e & f) ^ (~e & g);
+        uint32_t t1 = h + s1 + ch + roundConstants[i] + w[i];
+        uint32_t s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+        uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t t2 = s0 + maj;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+void HashSha256::update(const void *data, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    totalSize += size;
+
+    if (blockSize > 0) {
+        size_t fill = std::min(size, block.size() - blockSize);
+        memcpy(block.data() + blockSize, bytes, fill);
+        blockSize += fill;
+        bytes += fill;
+        size -= fill;
+        if (blockSize < block.size())
+            return;
+        transform(block.data());
+        blockSize = 0;
+    }
+
+    for (; size >= block.size(); bytes += block.size(), size -= block.size())
+        transform(bytes);
+
+    memcpy(block.data(), bytes, size);
+    blockSize = size;
+}
+
+HashSha256::Digest HashSha256::final() {
+    uint64_t bitSize = totalSize * 8;
+
+    // Padding is a single 1 bit, zeros up to 56 bytes of the last block and the size in bits
+    block[blockSize++] = 0x80;
+    if (blockSize > block.size() - sizeof(bitSize)) {
+        std::fill(block.begin() + static_cast<ptrdiff_t>(blockSize), block.end(), 0);
+        transform(block.data());
+        blockSize = 0;
+    }
+    std::fill(block.begin() + static_cast<ptrdiff_t>(blockSize),
+              block.end() - sizeof(bitSize),
+              0);
+    for (size_t i = 0; i < sizeof(bitSize); i++)
+        block[block.size() - 1 - i] = static_cast<uint8_t>(bitSize >> (i * 8));
+    transform(block.data());
+
+    Digest digest;
+    for (size_t i = 0; i < state.size(); i++) {
+        digest[i * 4] = static_cast<uint8_t>(state[i] >> 24);
+        digest[i * 4 + 1] = static_cast<uint8_t>(state[i] >> 16);
+        digest[i * 4 + 2] = static_cast<uint8_t>(state[i] >> 8);
+        digest[i * 4 + 3] = static_cast<uint8_t>(state[i]);
+    }
+    return digest;
+}
+
+HashSha256::Digest HashSha256::getDigest(const void *data, size_t size) {
+    HashSha256 hash;
+    hash.update(data, size);
+    return hash.final();
+}
+
+} // namespace VPU
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+namespace VPU {
+
+/**
+ * SHA-256 digest as specified by FIPS 180-4. Content may be passed in parts of any size.
+ */
+class HashSha256 {
+  public:
+    using Digest = std::array<uint8_t, 32>;
+
+    HashSha256();
+
+    void update(const void *data, size_t size);
+
+    /**
+     * Finish the hash, the object must not be updated afterwards
+     */
+    Digest final();
+
+    static Digest getDigest(const void *data, size_t size);
+
+  private:
+    void transform(const uint8_t *block);
+
+    std::array<uint32_t, 8> state;
+    std::array<uint8_t, 64> block = {};
+    size_t blockSize = 0;
+    uint64_t totalSize = 0;
+};
+
+} // namespace VPU
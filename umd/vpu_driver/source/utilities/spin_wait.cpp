@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include "vpu_driver/source/utilities/spin_wait.hpp"
+
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <atomic>
+#include <charconv>
+#include <stdlib.h>
+#include <string_view>
+#include <thread>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <immintrin.h>
+#include <x86intrin.h>
+#endif
+
+namespace VPU {
+
+namespace {
+
+// Upper bound of single UMWAIT, keeps the spin time and timeout granularity in microseconds
+constexpr uint64_t umwaitMaxCycles = 10000;
+
+struct AtomicConfig {
+    std::atomic<int64_t> spinTimeUs;
+    std::atomic<SpinWait::Relax> relax;
+
+    AtomicConfig() {
+        auto config = SpinWait::getConfigFromEnv();
+        spinTimeUs = config.spinTime.count();
+        relax = config.relax;
+        LOG(MISC,
+            "Spin wait time: %ld us, relax mode: %d",
+            spinTimeUs.load(),
+            static_cast<int>(relax.load()));
+    }
+};
+
+AtomicConfig &getAtomicConfig() {
+    static AtomicConfig config;
+    return config;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("waitpkg"))) void
+umwait(const volatile uint64_t *addr, uint64_t value, uint64_t cycles) {
+    _umonitor(const_cast<uint64_t *>(addr));
+    // Value written between the poll and the monitor setup would not wake up the CPU
+    if (*addr != value)
+        return;
+    // State 0 selects C0.2, it has the lower wake up latency of both states
+    _umwait(0, __rdtsc() + cycles);
+}
+#endif
+
+} // namespace
+
+SpinWait::Config SpinWait::getConfigFromEnv() {
+    Config config;
+
+    const char *env = getenv("ZE_INTEL_NPU_WAIT_SPIN_US");
+    if (env) {
+        int64_t val = config.spinTime.count();
+        std::string_view envStr = env;
+        // On error "from_chars" function leave "val" unmodified
+        std::from_chars(envStr.begin(), envStr.end(), val);
+        if (val >= 0)
+            config.spinTime = std::chrono::microseconds(val);
+        else
+            LOG_W("Negative ZE_INTEL_NPU_WAIT_SPIN_US value: %s", env);
+    }
+
+    env = getenv("ZE_INTEL_NPU_WAIT_RELAX");
+    if (env) {
+        std::string_view envStr = env;
+        if (envStr == "yield")
+            config.relax = Relax::YIELD;
+        else if (envStr == "pause")
+            config.relax = Relax::PAUSE;
+        else if (envStr == "umwait")
+            config.relax = Relax::UMWAIT;
+        else
+            LOG_W("Unknown ZE_INTEL_NPU_WAIT_RELAX value: %s", env);
+    }
+
+    return config;
+}
+
+SpinWait::Config SpinWait::getConfig() {
+    auto &atomicConfig = getAtomicConfig();
+    Config config;
+    config.spinTime = std::chrono::microseconds(atomicConfig.spinTimeUs.load());
+    config.relax = atomicConfig.relax.load();
+    return config;
+}
+
+void SpinWait::setConfig(const Config &config) {
+    auto &atomicConfig = getAtomicConfig();
+    atomicConfig.spinTimeUs = config.spinTime.count();
+    atomicConfig.relax = config.relax;
+}
+
+bool SpinWait::isUmwaitSupported() {
+#if defined(__x86_64__)
+    static const bool supported = [] {
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+            return false;
+        // CPUID.(EAX=07H, ECX=0):ECX[bit 5] reports WAITPKG
+        return (ecx & (1u << 5)) != 0;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+void SpinWait::relax(Relax mode, const volatile uint64_t *addr, uint64_t value) {
+#if defined(__x86_64__)
+    if (mode == Relax::UMWAIT) {
+        if (isUmwaitSupported()) {
+            umwait(addr, value, umwaitMaxCycles);
+            return;
+        }
+        mode = Relax::PAUSE;
+    }
+
+    if (mode == Relax::PAUSE) {
+        _mm_pause();
+        return;
+    }
+#endif
+    std::this_thread::yield();
+}
+
+} // namespace VPU
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include <stdint.h>
+
+#include <chrono> // IWYU pragma: keep
+
+namespace VPU {
+
+/**
+ * First phase of hybrid wait. Completion written by the device to memory is polled for bounded
+ * time, callers fall back to blocking wait in kernel driver once the spin ends. Short jobs then
+ * complete without a syscall and scheduler wake up.
+ */
+class SpinWait {
+  public:
+    enum class Relax {
+        // Give up CPU to other threads between polls
+        YIELD,
+        // Spin loop hint, falls back to YIELD on other architectures than x86
+        PAUSE,
+        // Sleep in light power state until the polled memory is written, falls back to PAUSE if
+        // the CPU does not support WAITPKG
+        UMWAIT,
+    };
+
+    struct Config {
+        // Zero disables spinning, waits go straight to kernel driver
+        std::chrono::microseconds spinTime = std::chrono::microseconds(20);
+        Relax relax = Relax::PAUSE;
+    };
+
+    /**
+     * Reads ZE_INTEL_NPU_WAIT_SPIN_US and ZE_INTEL_NPU_WAIT_RELAX (yield, pause, umwait)
+     */
+    static Config getConfigFromEnv();
+
+    /**
+     * Process wide configuration, initialized from environment
+     */
+    static Config getConfig();
+    static void setConfig(const Config &config);
+
+    static bool isUmwaitSupported();
+
+    /**
+     * Poll value in memory until it is accepted by the predicate
+     * @param addr[in]: Memory written by the device
+     * @param ready[in]: Predicate called with the polled value
+     * @param timeoutAbsNs[in]: Absolute timeout in steady clock nanoseconds
+     * @return false if the spin time or the timeout passed before the value was accepted
+     */
+    template <typename Ready>
+    static bool spinUntil(const volatile uint64_t *addr, Ready &&ready, int64_t timeoutAbsNs) {
+        if (ready(*addr))
+            return true;
+
+        Config config = getConfig();
+        auto spinEnd = std::chrono::steady_clock::now() + config.spinTime;
+        for (;;) {
+            auto now = std::chrono::steady_clock::now();
+            if (now >= spinEnd || now.time_since_epoch().count() >= timeoutAbsNs)
+                return false;
+
+            uint64_t value = *addr;
+            if (ready(value))
+                return true;
+
+            relax(config.relax, addr, value);
+            if (ready(*addr))
+                return true;
+        }
+    }
+
+  private:
+    /**
+     * Wait a little before the next poll of memory that still holds value
+     */
+    static void relax(Relax mode, const volatile uint64_t *addr, uint64_t value);
+};
+
+} // namespace VPU
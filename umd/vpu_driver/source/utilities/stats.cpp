@@ -59,6 +59,8 @@ void MemoryStatistics::enable(std::string_view statsPath) {
             << "DrvUsedHost, "
             << "DrvUsedShared, "
             << "DrvUsedInternal, "
+            << "DrvPrefaulted, "
+            << "DrvPrefaultTime[usec], "
             << "RSS[Kb], "
             << "UserTime[sec.usec], "
             << "SysTime[sec.usec]" << std::endl;
@@ -122,6 +124,16 @@ void MemoryStatistics::dec(VPU::VPUBufferObject::Location loc, size_t size) {
     }
 }
 
+void MemoryStatistics::addPrefault(size_t size, std::chrono::steady_clock::duration time) {
+    if (!enabled)
+        return;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    prefaultSize += size;
+    prefaultTimeUs += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(time).count());
+}
+
 void MemoryStatistics::snapshot() {
     if (!enabled)
         return;
@@ -146,6 +158,8 @@ void MemoryStatistics::snapshot() {
     statOut << (hostAllocSize) << ", ";
     statOut << (sharedAllocSize) << ", ";
     statOut << (internalAllocSize) << ", ";
+    statOut << (prefaultSize) << ", ";
+    statOut << (prefaultTimeUs) << ", ";
     statOut << procStats.ru_maxrss << ", ";
     statOut << procStats.ru_utime.tv_sec << "." << procStats.ru_utime.tv_usec << ", ";
     statOut << procStats.ru_stime.tv_sec << "." << procStats.ru_stime.tv_usec << std::endl;
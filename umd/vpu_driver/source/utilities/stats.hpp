@@ -12,6 +12,7 @@
 
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 
+#include <chrono>
 #include <fstream>
 #include <mutex>
 #include <string_view>
@@ -25,6 +26,7 @@ class MemoryStatistics final {
     bool isEnabled();
     void inc(VPU::VPUBufferObject::Location loc, size_t size);
     void dec(VPU::VPUBufferObject::Location loc, size_t size);
+    void addPrefault(size_t size, std::chrono::steady_clock::duration time);
     void snapshot();
 
   private:
@@ -36,4 +38,6 @@ class MemoryStatistics final {
     uint64_t sharedAllocSize = 0;
     uint64_t deviceAllocSize = 0;
     uint64_t hostAllocSize = 0;
+    uint64_t prefaultSize = 0;
+    uint64_t prefaultTimeUs = 0;
 };
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "vpu_driver/source/utilities/thread_pool.hpp"
+
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <system_error>
+#include <utility>
+
+namespace VPU {
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++) {
+        try {
+            threads.emplace_back(&ThreadPool::run, this);
+        } catch (const std::system_error &err) {
+            LOG_W("Failed to start pool thread %zu of %zu, error: %s", i, threadCount, err.what());
+            break;
+        }
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        const std::lock_guard<std::mutex> lock(mtx);
+        stop = true;
+    }
+    condition.notify_all();
+    for (auto &thread : threads)
+        thread.join();
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    if (threads.empty()) {
+        task();
+        return;
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(mtx);
+        tasks.push_back(std::move(task));
+    }
+    condition.notify_one();
+}
+
+void ThreadPool::runParallel(size_t count,
+                             size_t maxThreads,
+                             const std::function<void(size_t)> &task) {
+    // Pool threads may pick up the helper after the call returned, the state outlives the call
+    struct State {
+        std::atomic<size_t> next = 0;
+        size_t count = 0;
+        const std::function<void(size_t)> *task = nullptr;
+        std::mutex mtx;
+        std::condition_variable condition;
+        size_t completed = 0;
+    };
+
+    auto state = std::make_shared<State>();
+    state->count = count;
+    state->task = &task;
+
+    auto worker = [](State &state) {
+        size_t completed = 0;
+        for (size_t i = state.next++; i < state.count; i = state.next++) {
+            (*state.task)(i);
+            completed++;
+        }
+        if (completed == 0)
+            return;
+
+        const std::lock_guard<std::mutex> lock(state.mtx);
+        state.completed += completed;
+        if (state.completed == state.count)
+            state.condition.notify_all();
+    };
+
+    size_t helpers = std::min({maxThreads, count, threads.size() + 1});
+    for (size_t i = 1; i < helpers; i++)
+        enqueue([state, worker] { worker(*state); });
+    worker(*state);
+
+    std::unique_lock<std::mutex> lock(state->mtx);
+    state->condition.wait(lock, [&state] { return state->completed == state->count; });
+}
+
+void ThreadPool::run() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            condition.wait(lock, [this] { return stop || !tasks.empty(); });
+            if (tasks.empty())
+                return;
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+} // namespace VPU
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace VPU {
+
+/**
+ * Fixed set of threads that run queued tasks in the enqueue order.
+ *
+ * Destructor runs every task that is still queued before it joins the threads. If no thread
+ * could be started the tasks run synchronously in enqueue.
+ */
+class ThreadPool {
+  public:
+    explicit ThreadPool(size_t threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * Queue task, thread safe. Task must not throw.
+     */
+    void enqueue(std::function<void()> task);
+
+    /**
+     * Run task for every index below count on up to maxThreads threads, the calling thread
+     * included. The calling thread takes indices too, so the call completes also when every pool
+     * thread is busy, e.g. when it is made from a task of the pool. Returns when all the tasks
+     * are completed. Task must not throw.
+     */
+    void runParallel(size_t count, size_t maxThreads, const std::function<void(size_t)> &task);
+
+    size_t getThreadCount() const { return threads.size(); }
+
+  private:
+    void run();
+
+    std::mutex mtx;
+    std::condition_variable condition;
+    std::deque<std::function<void()>> tasks;
+    bool stop = false;
+
+    std::vector<std::thread> threads;
+};
+
+} // namespace VPU
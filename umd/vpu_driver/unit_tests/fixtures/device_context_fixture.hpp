@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/unit_tests/mocks/mock_os_interface_imp.hpp"
+#include "vpu_driver/unit_tests/mocks/mock_vpu_device.hpp"
+#include "vpu_driver/unit_tests/test_macros/test.hpp"
+
+#include <memory>
+
+namespace VPU {
+
+struct DeviceContextFixture {
+    virtual void SetUp() {}
+
+    virtual void TearDown() { ASSERT_EQ(ctx->getBuffersCount(), 0u); }
+
+    std::shared_ptr<VPUBufferObject>
+    createBo(size_t size,
+             VPUBufferObject::Type type = VPUBufferObject::Type::CachedFw,
+             VPUBufferObject::Location location = VPUBufferObject::Location::Internal) {
+        return VPUBufferObject::create(ctx->getDriverApi(), location, type, size);
+    }
+
+    MockOsInterfaceImp osInfc;
+    std::unique_ptr<MockVPUDevice> vpuDevice = MockVPUDevice::createWithDefaultHardwareInfo(osInfc);
+    std::shared_ptr<VPUDeviceContext> ctx = vpuDevice->createDeviceContext();
+};
+
+} // namespace VPU
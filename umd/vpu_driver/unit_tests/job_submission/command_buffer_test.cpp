@@ -92,4 +92,75 @@ TEST_F(VPUCommandBufferTest, allocateCommandBufferWithCopyCommand) {
     EXPECT_TRUE(ctx->freeMemAlloc(dstBo->getBasePointer()));
 }
 
+TEST_F(VPUCommandBufferTest, replaceBufferHandlesKeepsHandlesUnique) {
+    std::vector<std::shared_ptr<VPUBufferObject>> bos;
+    std::vector<std::shared_ptr<VPUCommand>> cmds;
+    for (int i = 0; i < 4; i++) {
+        bos.push_back(ctx->createSharedMemAlloc(sizeof(uint64_t)));
+        cmds.emplace_back(VPUTimeStampCommand::create(
+            reinterpret_cast<uint64_t *>(bos.back()->getBasePointer()),
+            bos.back()));
+    }
+
+    auto cmdBuffer =
+        VPUCommandBuffer::allocateCommandBuffer(ctx, cmds.begin(), cmds.end(), nullptr, eventBo);
+    ASSERT_NE(cmdBuffer, nullptr);
+    ASSERT_EQ(5u, cmdBuffer->getBufferHandles().size());
+    uint32_t cmdBufferHandle = cmdBuffer->getBufferHandles()[0];
+
+    std::vector<uint32_t> oldHandles = {bos[0]->getHandle(), bos[1]->getHandle()};
+    std::vector<uint32_t> newHandles = {bos[1]->getHandle(), bos[3]->getHandle(), 1000u, 1000u};
+    EXPECT_TRUE(cmdBuffer->replaceBufferHandles(oldHandles, newHandles));
+
+    std::vector<uint32_t> expHandles =
+        {cmdBufferHandle, bos[2]->getHandle(), bos[3]->getHandle(), bos[1]->getHandle(), 1000u};
+    EXPECT_EQ(expHandles, cmdBuffer->getBufferHandles());
+
+    cmdBuffer.reset();
+    cmds.clear();
+    for (auto &bo : bos)
+        EXPECT_TRUE(ctx->freeMemAlloc(bo->getBasePointer()));
+}
+
+
+TEST_F(VPUCommandBufferTest, replaceBufferHandlesKeepsHandlesUniqueForManyBuffers) {
+    const size_t cmdCount = 40;
+    std::vector<std::shared_ptr<VPUBufferObject>> bos;
+    std::vector<std::shared_ptr<VPUCommand>> cmds;
+    for (size_t i = 0; i < cmdCount; i++) {
+        bos.push_back(ctx->createSharedMemAlloc(sizeof(uint64_t)));
+        cmds.emplace_back(VPUTimeStampCommand::create(
+            reinterpret_cast<uint64_t *>(bos.back()->getBasePointer()),
+            bos.back()));
+    }
+
+    auto cmdBuffer =
+        VPUCommandBuffer::allocateCommandBuffer(ctx, cmds.begin(), cmds.end(), nullptr, eventBo);
+    ASSERT_NE(cmdBuffer, nullptr);
+    ASSERT_EQ(cmdCount + 1, cmdBuffer->getBufferHandles().size());
+    uint32_t cmdBufferHandle = cmdBuffer->getBufferHandles()[0];
+
+    std::vector<uint32_t> oldHandles, newHandles;
+    std::vector<uint32_t> expHandles = {cmdBufferHandle};
+    for (size_t i = 0; i < cmdCount; i++) {
+        if (i % 2 == 0) {
+            oldHandles.push_back(bos[i]->getHandle());
+        } else {
+            expHandles.push_back(bos[i]->getHandle());
+            newHandles.push_back(bos[i]->getHandle());
+        }
+    }
+    for (uint32_t i = 0; i < cmdCount; i++) {
+        newHandles.push_back(1000u + i);
+        expHandles.push_back(1000u + i);
+    }
+    EXPECT_TRUE(cmdBuffer->replaceBufferHandles(oldHandles, newHandles));
+    EXPECT_EQ(expHandles, cmdBuffer->getBufferHandles());
+
+    cmdBuffer.reset();
+    cmds.clear();
+    for (auto &bo : bos)
+        EXPECT_TRUE(ctx->freeMemAlloc(bo->getBasePointer()));
+}
+
 } // namespace VPU
@@ -9,15 +9,18 @@
 #include <stdint.h>
 
 #include "gtest/gtest.h"
+#include "umd_common.hpp"
 #include "vpu_driver/source/command/vpu_command_buffer.hpp"
 #include "vpu_driver/source/command/vpu_copy_command.hpp"
 #include "vpu_driver/source/command/vpu_event_command.hpp"
 #include "vpu_driver/source/command/vpu_job.hpp"
 #include "vpu_driver/source/command/vpu_ts_command.hpp"
+#include "vpu_driver/source/device/vpu_command_queue.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 #include "vpu_driver/unit_tests/mocks/mock_os_interface_imp.hpp"
 #include "vpu_driver/unit_tests/mocks/mock_vpu_device.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <string>
@@ -201,3 +204,252 @@ TEST_F(VPUJobTest, checkJobStatus) {
 
     EXPECT_TRUE(ctx->freeMemAlloc(tsHeap->getBasePointer()));
 }
+
+TEST_F(VPUJobTest, closeCommandsReusesCommandBufferStorageOfPreviousJob) {
+    const int cmdCount = 4;
+
+    auto mem = ctx->createSharedMemAlloc(sizeof(uint64_t) * cmdCount);
+    uint64_t *tsHeap = reinterpret_cast<uint64_t *>(mem->getBasePointer());
+
+    auto job = std::make_unique<VPUJob>(ctx);
+    for (int i = 0; i < cmdCount; i++)
+        EXPECT_TRUE(job->appendCommand(VPUTimeStampCommand::create(tsHeap + i, mem)));
+    EXPECT_TRUE(job->closeCommands());
+    ASSERT_EQ(1u, job->getCommandBuffers().size());
+    const uint8_t *bufferPtr = job->getCommandBuffers()[0]->getBufferPtr();
+
+    auto storage = job->takeCommandBufferStorage();
+    EXPECT_EQ(0u, job->getCommandBuffers().size());
+    ASSERT_EQ(1u, storage.size());
+    job.reset();
+
+    const uint32_t mmapCount = osInfc.callCntAlloc;
+    auto nextJob = std::make_unique<VPUJob>(ctx, std::move(storage));
+    for (int i = 0; i < cmdCount / 2; i++)
+        EXPECT_TRUE(nextJob->appendCommand(VPUTimeStampCommand::create(tsHeap + i, mem)));
+    EXPECT_TRUE(nextJob->closeCommands());
+    ASSERT_EQ(1u, nextJob->getCommandBuffers().size());
+    EXPECT_EQ(bufferPtr, nextJob->getCommandBuffers()[0]->getBufferPtr());
+    EXPECT_EQ(mmapCount, osInfc.callCntAlloc);
+
+    auto *header = reinterpret_cast<const vpu_cmd_buffer_header_t *>(bufferPtr);
+    // Timeline signal closes every command buffer
+    EXPECT_EQ(header->cmd_buffer_size,
+              header->cmd_offset + (cmdCount / 2) * sizeof(vpu_cmd_timestamp_t) +
+                  sizeof(vpu_cmd_fence_t));
+
+    nextJob.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(mem->getBasePointer()));
+}
+
+TEST_F(VPUJobTest, takeCommandBufferStorageSkipsBuffersReferencedOutsideOfJob) {
+    auto mem = ctx->createSharedMemAlloc(sizeof(uint64_t));
+    uint64_t *tsHeap = reinterpret_cast<uint64_t *>(mem->getBasePointer());
+
+    auto job = std::make_unique<VPUJob>(ctx);
+    EXPECT_TRUE(job->appendCommand(VPUTimeStampCommand::create(tsHeap, mem)));
+    EXPECT_TRUE(job->closeCommands());
+    ASSERT_EQ(1u, job->getCommandBuffers().size());
+
+    auto inUse = job->getCommandBuffers()[0]->getBuffer();
+    EXPECT_EQ(0u, job->takeCommandBufferStorage().size());
+    EXPECT_EQ(0u, job->getCommandBuffers().size());
+    EXPECT_EQ(1, inUse.use_count());
+
+    job.reset();
+    inUse.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(mem->getBasePointer()));
+}
+
+TEST_F(VPUJobTest, closeCommandsPatchesDescriptorAddressInCopyCommands) {
+    auto destBo = ctx->createSharedMemAlloc(allocSize);
+    auto srcBo = ctx->createHostMemAlloc(allocSize);
+    auto tsBo = ctx->createSharedMemAlloc(sizeof(uint64_t));
+
+    auto job = std::make_unique<VPUJob>(ctx);
+    std::vector<std::shared_ptr<VPUCommand>> copyCmds;
+    for (int i = 0; i < 3; i++) {
+        copyCmds.push_back(VPUCopyCommand::create(ctx,
+                                                  srcBo->getBasePointer(),
+                                                  srcBo,
+                                                  destBo->getBasePointer(),
+                                                  destBo,
+                                                  allocSize));
+        EXPECT_TRUE(job->appendCommand(copyCmds.back()));
+        auto *tsHeap = reinterpret_cast<uint64_t *>(tsBo->getBasePointer());
+        EXPECT_TRUE(job->appendCommand(VPUTimeStampCommand::create(tsHeap, tsBo)));
+    }
+    EXPECT_TRUE(job->closeCommands());
+    ASSERT_EQ(1u, job->getCommandBuffers().size());
+
+    const auto &cmdBuffer = job->getCommandBuffers()[0];
+    const uint8_t *bufferPtr = cmdBuffer->getBufferPtr();
+    auto *header = reinterpret_cast<const vpu_cmd_buffer_header_t *>(bufferPtr);
+    uint64_t descVpuAddr = cmdBuffer->getBuffer()->getVPUAddr() + header->cmd_offset +
+                           getFwDataCacheAlign(header->cmd_buffer_size - header->cmd_offset);
+
+    size_t copyIndex = 0;
+    for (uint32_t offset = header->cmd_offset; offset < header->cmd_buffer_size;) {
+        auto *cmd = reinterpret_cast<const vpu_cmd_header_t *>(bufferPtr + offset);
+        ASSERT_NE(0u, cmd->size);
+        if (cmd->type == VPU_CMD_COPY_LOCAL_TO_LOCAL) {
+            auto *copy = reinterpret_cast<const vpu_cmd_copy_buffer_t *>(cmd);
+            EXPECT_EQ(descVpuAddr, copy->desc_start_offset);
+            descVpuAddr += getFwDataCacheAlign(copyCmds[copyIndex++]->getDescriptorSize());
+        }
+        offset += cmd->size;
+    }
+    EXPECT_EQ(copyCmds.size(), copyIndex);
+
+    job.reset();
+    copyCmds.clear();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsBo->getBasePointer()));
+    EXPECT_TRUE(ctx->freeMemAlloc(srcBo->getBasePointer()));
+    EXPECT_TRUE(ctx->freeMemAlloc(destBo->getBasePointer()));
+}
+
+TEST_F(VPUJobTest, orderedJobsAreChainedWithCompletionFence) {
+    auto mem = ctx->createSharedMemAlloc(sizeof(uint64_t));
+    uint64_t *tsHeap = reinterpret_cast<uint64_t *>(mem->getBasePointer());
+
+    // Return the first command or the completion signal that precedes the timeline signal
+    auto getCommand = [](const VPUCommandBuffer &cmdBuffer, bool first) {
+        const uint8_t *bufferPtr = cmdBuffer.getBufferPtr();
+        auto *header = reinterpret_cast<const vpu_cmd_buffer_header_t *>(bufferPtr);
+        std::vector<const vpu_cmd_header_t *> cmds;
+        for (uint32_t offset = header->cmd_offset; offset < header->cmd_buffer_size;) {
+            cmds.push_back(reinterpret_cast<const vpu_cmd_header_t *>(bufferPtr + offset));
+            if (cmds.back()->size == 0)
+                break;
+            offset += cmds.back()->size;
+        }
+        return first ? cmds.front() : cmds[cmds.size() - 2];
+    };
+
+    auto firstJob = std::make_unique<VPUJob>(ctx);
+    EXPECT_TRUE(firstJob->appendCommand(VPUTimeStampCommand::create(tsHeap, mem)));
+    firstJob->setOrderingFence(nullptr, nullptr);
+    EXPECT_TRUE(firstJob->closeCommands());
+    ASSERT_EQ(1u, firstJob->getCommandBuffers().size());
+    ASSERT_NE(nullptr, firstJob->getCompletionFence());
+    ASSERT_NE(nullptr, firstJob->getCompletionFenceBo());
+    uint64_t firstFenceAddr =
+        firstJob->getCompletionFenceBo()->getVPUAddr(firstJob->getCompletionFence());
+
+    // Job without preceding fence only signals its completion
+    const auto &firstBuffer = *firstJob->getCommandBuffers()[0];
+    EXPECT_EQ(VPU_CMD_TIMESTAMP, getCommand(firstBuffer, true)->type);
+    auto *signal = reinterpret_cast<const vpu_cmd_fence_t *>(getCommand(firstBuffer, false));
+    EXPECT_EQ(VPU_CMD_FENCE_SIGNAL, signal->header.type);
+    EXPECT_EQ(firstFenceAddr, signal->offset);
+
+    auto nextJob = std::make_unique<VPUJob>(ctx);
+    EXPECT_TRUE(nextJob->appendCommand(VPUTimeStampCommand::create(tsHeap, mem)));
+    nextJob->setOrderingFence(firstJob->getCompletionFence(), firstJob->getCompletionFenceBo());
+    EXPECT_TRUE(nextJob->closeCommands());
+    ASSERT_EQ(1u, nextJob->getCommandBuffers().size());
+
+    const auto &nextBuffer = *nextJob->getCommandBuffers()[0];
+    auto *wait = reinterpret_cast<const vpu_cmd_fence_t *>(getCommand(nextBuffer, true));
+    EXPECT_EQ(VPU_CMD_FENCE_WAIT, wait->header.type);
+    EXPECT_EQ(firstFenceAddr, wait->offset);
+    signal = reinterpret_cast<const vpu_cmd_fence_t *>(getCommand(nextBuffer, false));
+    EXPECT_EQ(VPU_CMD_FENCE_SIGNAL, signal->header.type);
+    EXPECT_EQ(nextJob->getCompletionFenceBo()->getVPUAddr(nextJob->getCompletionFence()),
+              signal->offset);
+
+    // Preceding command buffer is passed to the kernel with the job that waits for it
+    const auto &handles = nextBuffer.getBufferHandles();
+    EXPECT_NE(handles.end(),
+              std::find(handles.begin(), handles.end(), firstBuffer.getBuffer()->getHandle()));
+
+    nextJob.reset();
+    firstJob.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(mem->getBasePointer()));
+}
+
+TEST_F(VPUJobTest, signalEventsAreKeptInlineInSingleCommandBuffer) {
+    constexpr size_t eventCount = 8;
+
+    auto mem = ctx->createSharedMemAlloc(sizeof(uint64_t));
+    uint64_t *tsHeap = reinterpret_cast<uint64_t *>(mem->getBasePointer());
+    auto eventBo =
+        ctx->createUntrackedBufferObject(eventCount * sizeof(VPUEventCommand::KMDEventDataType),
+                                         VPU::VPUBufferObject::Type::CachedFw);
+    ASSERT_TRUE(eventBo);
+    auto *eventPtr =
+        reinterpret_cast<VPUEventCommand::KMDEventDataType *>(eventBo->getBasePointer());
+
+    // Signal event after each command
+    auto job = std::make_shared<VPUJob>(ctx);
+    for (size_t i = 0; i < eventCount; i++) {
+        EXPECT_TRUE(job->appendCommand(VPUTimeStampCommand::create(tsHeap, mem)));
+        EXPECT_TRUE(job->appendCommand(VPUEventSignalCommand::create(&eventPtr[i], eventBo)));
+    }
+    EXPECT_TRUE(job->closeCommands());
+
+    ASSERT_EQ(1u, job->getCommandBuffers().size());
+    const auto &cmdBuffer = job->getCommandBuffers()[0];
+    for (size_t i = 0; i < eventCount; i++)
+        EXPECT_TRUE(cmdBuffer->hasFenceAddr(eventBo->getVPUAddr(&eventPtr[i])));
+    EXPECT_FALSE(cmdBuffer->hasFenceAddr(eventBo->getVPUAddr(eventPtr) + eventBo->getAllocSize()));
+
+    auto queue = VPUDeviceQueue::create(ctx, VPUDeviceQueue::Priority::NORMAL, false);
+    ASSERT_NE(nullptr, queue);
+    osInfc.callCntSubmit = 0;
+    EXPECT_TRUE(queue->submit(job.get()));
+    EXPECT_EQ(1u, osInfc.callCntSubmit);
+
+    queue.reset();
+    job.reset();
+    eventBo.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(mem->getBasePointer()));
+}
+
+TEST_F(VPUJobTest, createFusedJobSubmitsAllCommandsInSingleCommandBuffer) {
+    auto mem = ctx->createSharedMemAlloc(sizeof(uint64_t));
+    uint64_t *tsHeap = reinterpret_cast<uint64_t *>(mem->getBasePointer());
+    auto eventBo = ctx->createUntrackedBufferObject(sizeof(VPUEventCommand::KMDEventDataType),
+                                                    VPU::VPUBufferObject::Type::CachedFw);
+    ASSERT_TRUE(eventBo);
+    auto *eventPtr =
+        reinterpret_cast<VPUEventCommand::KMDEventDataType *>(eventBo->getBasePointer());
+
+    // Second job signals an event in the middle
+    std::vector<std::shared_ptr<VPUJob>> jobs;
+    for (int i = 0; i < 3; i++) {
+        jobs.push_back(std::make_shared<VPUJob>(ctx));
+        EXPECT_TRUE(jobs.back()->appendCommand(VPUTimeStampCommand::create(tsHeap, mem)));
+        if (i == 1) {
+            EXPECT_TRUE(
+                jobs.back()->appendCommand(VPUEventSignalCommand::create(eventPtr, eventBo)));
+        }
+        EXPECT_TRUE(jobs.back()->appendCommand(VPUTimeStampCommand::create(tsHeap, mem)));
+        EXPECT_TRUE(jobs.back()->closeCommands());
+    }
+    EXPECT_EQ(1u, jobs[1]->getCommandBuffers().size());
+
+    auto fused = VPUJob::createFused(ctx, jobs);
+    ASSERT_NE(nullptr, fused);
+    EXPECT_TRUE(fused->isClosed());
+    EXPECT_EQ(7u, fused->getNumCommands());
+    ASSERT_EQ(1u, fused->getCommandBuffers().size());
+    EXPECT_TRUE(fused->getCommandBuffers()[0]->hasFenceAddr(eventBo->getVPUAddr(eventPtr)));
+
+    auto queue = VPUDeviceQueue::create(ctx, VPUDeviceQueue::Priority::NORMAL, false);
+    ASSERT_NE(nullptr, queue);
+    osInfc.callCntSubmit = 0;
+    for (const auto &job : jobs)
+        EXPECT_TRUE(queue->submit(job.get()));
+    EXPECT_EQ(3u, osInfc.callCntSubmit);
+
+    osInfc.callCntSubmit = 0;
+    EXPECT_TRUE(queue->submit(fused.get()));
+    EXPECT_EQ(1u, osInfc.callCntSubmit);
+
+    queue.reset();
+    fused.reset();
+    jobs.clear();
+    eventBo.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(mem->getBasePointer()));
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_cache.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/unit_tests/fixtures/device_context_fixture.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string.h>
+
+using namespace VPU;
+
+using VPUBufferCacheTest = Test<DeviceContextFixture>;
+
+TEST_F(VPUBufferCacheTest, acquireReturnsReleasedBufferOfSameSizeClass) {
+    VPUBufferCache cache(VPUBufferCache::defaultMaxSize);
+
+    EXPECT_EQ(cache.acquire(VPUBufferObject::Type::CachedFw, 4096), nullptr);
+    EXPECT_EQ(cache.getMissCount(), 1u);
+
+    auto bo = createBo(4096, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(bo, nullptr);
+    auto *rawBo = bo.get();
+    EXPECT_TRUE(cache.release(std::move(bo)));
+    EXPECT_EQ(cache.getCachedCount(), 1u);
+    EXPECT_EQ(cache.getCachedSize(), 4096u);
+
+    EXPECT_EQ(cache.acquire(VPUBufferObject::Type::CachedFw, 8192), nullptr);
+    EXPECT_EQ(cache.acquire(VPUBufferObject::Type::WriteCombineFw, 4096), nullptr);
+
+    bo = cache.acquire(VPUBufferObject::Type::CachedFw, 4096);
+    EXPECT_EQ(bo.get(), rawBo);
+    EXPECT_EQ(cache.getHitCount(), 1u);
+    EXPECT_EQ(cache.getMissCount(), 3u);
+    EXPECT_EQ(cache.getCachedCount(), 0u);
+    EXPECT_EQ(cache.getCachedSize(), 0u);
+}
+
+TEST_F(VPUBufferCacheTest, releaseDropsBufferWhenCacheIsFull) {
+    VPUBufferCache cache(8192);
+
+    EXPECT_TRUE(cache.release(createBo(4096, VPUBufferObject::Type::CachedFw)));
+    EXPECT_TRUE(cache.release(createBo(4096, VPUBufferObject::Type::CachedFw)));
+    EXPECT_FALSE(cache.release(createBo(4096, VPUBufferObject::Type::CachedFw)));
+    EXPECT_FALSE(cache.release(createBo(16384, VPUBufferObject::Type::CachedFw)));
+    EXPECT_EQ(cache.getCachedSize(), 8192u);
+
+    cache.clear();
+    EXPECT_EQ(cache.getCachedCount(), 0u);
+    EXPECT_EQ(cache.getCachedSize(), 0u);
+}
+
+TEST_F(VPUBufferCacheTest, disabledCacheDoesNotKeepBuffers) {
+    VPUBufferCache cache(0);
+
+    EXPECT_FALSE(cache.isEnabled());
+    EXPECT_FALSE(cache.release(createBo(4096, VPUBufferObject::Type::CachedFw)));
+    EXPECT_EQ(cache.acquire(VPUBufferObject::Type::CachedFw, 4096), nullptr);
+}
+
+TEST_F(VPUBufferCacheTest, uncachedTypeIsNotRecycled) {
+    VPUBufferCache cache(VPUBufferCache::defaultMaxSize);
+
+    EXPECT_FALSE(cache.release(createBo(4096, VPUBufferObject::Type::UncachedFw)));
+    EXPECT_EQ(cache.getCachedCount(), 0u);
+}
+
+TEST_F(VPUBufferCacheTest, trimReleasesIdleBuffers) {
+    VPUBufferCache cache(VPUBufferCache::defaultMaxSize, std::chrono::seconds(0));
+
+    EXPECT_TRUE(cache.release(createBo(4096, VPUBufferObject::Type::CachedFw)));
+    EXPECT_EQ(cache.getCachedCount(), 1u);
+
+    cache.trim();
+    EXPECT_EQ(cache.getCachedCount(), 0u);
+    EXPECT_EQ(cache.getCachedSize(), 0u);
+}
+
+TEST_F(VPUBufferCacheTest, usageReportsBuffersKeptInPool) {
+    VPUBufferCache cache(VPUBufferCache::defaultMaxSize);
+
+    EXPECT_TRUE(cache.release(createBo(4096, VPUBufferObject::Type::CachedFw)));
+    EXPECT_TRUE(cache.release(createBo(8192, VPUBufferObject::Type::CachedFw)));
+    EXPECT_NE(cache.acquire(VPUBufferObject::Type::CachedFw, 8192), nullptr);
+
+    auto usage = cache.getUsage();
+    EXPECT_EQ(usage.size, 4096u);
+    EXPECT_EQ(usage.count, 1u);
+    EXPECT_EQ(usage.peakSize, 12288u);
+    EXPECT_EQ(usage.peakCount, 2u);
+}
+
+TEST_F(VPUBufferCacheTest, untrackedBufferIsRecycledThroughDeviceContext) {
+    auto &cache = ctx->getBufferCache();
+    if (!cache.isEnabled())
+        GTEST_SKIP() << "Buffer cache is disabled by environment";
+
+    auto bo = ctx->createUntrackedBufferObject(100, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(bo, nullptr);
+    EXPECT_EQ(bo->getAllocSize(), 4096u);
+    EXPECT_EQ(ctx->getBuffersCount(), 1u);
+
+    auto *basePtr = bo->getBasePointer();
+    memset(basePtr, 0xab, bo->getAllocSize());
+    uint32_t allocCount = osInfc.callCntAlloc;
+
+    bo.reset();
+    EXPECT_EQ(ctx->getBuffersCount(), 0u);
+    EXPECT_EQ(cache.getCachedCount(), 1u);
+    EXPECT_EQ(osInfc.callCntFree, 0u);
+    // Buffer kept in the pool is reported by the pool instead of the context counters
+    EXPECT_EQ(ctx->getBufferCounters().getTotal().size, 0u);
+    EXPECT_EQ(cache.getUsage().size, 4096u);
+
+    bo = ctx->createUntrackedBufferObject(4000, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(bo, nullptr);
+    EXPECT_EQ(bo->getBasePointer(), basePtr);
+    EXPECT_EQ(osInfc.callCntAlloc, allocCount);
+    EXPECT_EQ(cache.getHitCount(), 1u);
+
+    for (size_t i = 0; i < bo->getAllocSize(); i++)
+        ASSERT_EQ(basePtr[i], 0u) << "Recycled buffer is not cleared at offset " << i;
+
+    bo.reset();
+}
+
+TEST_F(VPUBufferCacheTest, failedAllocationReleasesCachedBuffersAndRetries) {
+    auto &cache = ctx->getBufferCache();
+    if (!cache.isEnabled())
+        GTEST_SKIP() << "Buffer cache is disabled by environment";
+
+    auto bo = ctx->createUntrackedBufferObject(8192, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(bo, nullptr);
+    bo.reset();
+    EXPECT_EQ(cache.getCachedCount(), 1u);
+
+    osInfc.mockFailNextAlloc();
+    bo = ctx->createUntrackedBufferObject(4096, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(bo, nullptr);
+    EXPECT_EQ(cache.getCachedCount(), 0u);
+    EXPECT_EQ(osInfc.callCntFree, 1u);
+
+    bo.reset();
+}
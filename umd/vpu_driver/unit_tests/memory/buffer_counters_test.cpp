@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_counters.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/unit_tests/fixtures/device_context_fixture.hpp"
+
+#include <memory>
+
+using namespace VPU;
+
+using VPUBufferCountersTest = Test<DeviceContextFixture>;
+
+TEST_F(VPUBufferCountersTest, trackedBuffersAreAccountedPerLocationAndType) {
+    auto &counters = ctx->getBufferCounters();
+
+    void *hostPtr = ctx->createMemAlloc(4096,
+                                        VPUBufferObject::Type::CachedShave,
+                                        VPUBufferObject::Location::Host);
+    void *devPtr = ctx->createMemAlloc(8192,
+                                       VPUBufferObject::Type::WriteCombineFw,
+                                       VPUBufferObject::Location::Device);
+    ASSERT_NE(hostPtr, nullptr);
+    ASSERT_NE(devPtr, nullptr);
+
+    EXPECT_EQ(ctx->getBuffersCount(), 2u);
+    EXPECT_EQ(ctx->getAllocatedSize(), 4096u + 8192u);
+
+    auto host = counters.getByLocation(VPUBufferCounters::LOCATION_HOST);
+    EXPECT_EQ(host.count, 1u);
+    EXPECT_EQ(host.size, 4096u);
+    auto device = counters.getByLocation(VPUBufferCounters::LOCATION_DEVICE);
+    EXPECT_EQ(device.count, 1u);
+    EXPECT_EQ(device.size, 8192u);
+    EXPECT_EQ(counters.getByType(VPUBufferCounters::TYPE_CACHED_SHAVE).size, 4096u);
+    EXPECT_EQ(counters.getByType(VPUBufferCounters::TYPE_WRITE_COMBINE_FW).size, 8192u);
+
+    EXPECT_TRUE(ctx->freeMemAlloc(devPtr));
+    auto total = counters.getTotal();
+    EXPECT_EQ(total.count, 1u);
+    EXPECT_EQ(total.size, 4096u);
+    EXPECT_EQ(total.peakCount, 2u);
+    EXPECT_EQ(total.peakSize, 4096u + 8192u);
+    EXPECT_EQ(counters.getByLocation(VPUBufferCounters::LOCATION_DEVICE).peakSize, 8192u);
+
+    EXPECT_TRUE(ctx->freeMemAlloc(hostPtr));
+    EXPECT_EQ(counters.getTotal().size, 0u);
+}
+
+TEST_F(VPUBufferCountersTest, untrackedBuffersAreAccountedAsInternal) {
+    auto bo = ctx->createUntrackedBufferObject(100, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(bo, nullptr);
+
+    auto internal = ctx->getBufferCounters().getByLocation(VPUBufferCounters::LOCATION_INTERNAL);
+    EXPECT_EQ(internal.count, 1u);
+    EXPECT_EQ(internal.size, bo->getAllocSize());
+    EXPECT_EQ(ctx->getAllocatedSize(), bo->getAllocSize());
+
+    bo.reset();
+    EXPECT_EQ(ctx->getAllocatedSize(), 0u);
+    EXPECT_EQ(ctx->getBufferCounters().getTotal().peakCount, 1u);
+}
+
+TEST_F(VPUBufferCountersTest, externalLocationIsAccountedWithItsBaseLocation) {
+    EXPECT_EQ(VPUBufferCounters::getLocationIndex(VPUBufferObject::Location::ExternalHost),
+              VPUBufferCounters::LOCATION_HOST);
+    EXPECT_EQ(VPUBufferCounters::getLocationIndex(VPUBufferObject::Location::ExternalDevice),
+              VPUBufferCounters::LOCATION_DEVICE);
+    EXPECT_EQ(VPUBufferCounters::getLocationIndex(VPUBufferObject::Location::ExternalShared),
+              VPUBufferCounters::LOCATION_SHARED);
+    EXPECT_EQ(VPUBufferCounters::getTypeIndex(VPUBufferObject::Type::ImportedMemory),
+              VPUBufferCounters::TYPE_IMPORTED_MEMORY);
+}
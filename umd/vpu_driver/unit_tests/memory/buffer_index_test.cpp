@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_index.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/unit_tests/fixtures/device_context_fixture.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace VPU;
+
+using VPUBufferIndexTest = Test<DeviceContextFixture>;
+
+TEST_F(VPUBufferIndexTest, findReturnsBufferContainingPointer) {
+    VPUBufferIndex index;
+    std::vector<std::shared_ptr<VPUBufferObject>> bos;
+    for (size_t i = 0; i < 8; i++)
+        bos.push_back(createBo(4096 * (i + 1)));
+
+    for (auto &bo : bos)
+        EXPECT_TRUE(index.insert(bo));
+    EXPECT_FALSE(index.insert(bos[0]));
+    EXPECT_EQ(index.size(), bos.size());
+
+    for (auto &bo : bos) {
+        EXPECT_EQ(index.find(bo->getBasePointer()), bo);
+        EXPECT_EQ(index.find(bo->getBasePointer() + bo->getAllocSize() - 1), bo);
+    }
+
+    uint8_t stackVar = 0;
+    EXPECT_EQ(index.find(&stackVar), nullptr);
+
+    EXPECT_EQ(index.erase(bos[3]->getBasePointer()), bos[3]);
+    EXPECT_EQ(index.erase(bos[3]->getBasePointer()), nullptr);
+    EXPECT_EQ(index.erase(bos[4]->getBasePointer() + 1), nullptr);
+    EXPECT_EQ(index.find(bos[3]->getBasePointer()), nullptr);
+    EXPECT_EQ(index.find(bos[4]->getBasePointer()), bos[4]);
+    EXPECT_EQ(index.size(), bos.size() - 1);
+
+    for (size_t i = 0; i < bos.size(); i++) {
+        if (i != 3) {
+            EXPECT_EQ(index.erase(bos[i]->getBasePointer()), bos[i]);
+        }
+    }
+    EXPECT_EQ(index.size(), 0u);
+}
+
+TEST_F(VPUBufferIndexTest, concurrentLookupWithAllocAndFree) {
+    std::vector<void *> ptrs;
+    for (size_t i = 0; i < 64; i++) {
+        ptrs.push_back(ctx->createMemAlloc(4096,
+                                           VPUBufferObject::Type::CachedFw,
+                                           VPUBufferObject::Location::Host));
+        ASSERT_NE(ptrs.back(), nullptr);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < 8; t++) {
+        readers.emplace_back([&, t]() {
+            size_t i = t;
+            while (!stop) {
+                auto *ptr = static_cast<uint8_t *>(ptrs[i++ % ptrs.size()]) + 128;
+                auto bo = ctx->findBufferObject(ptr);
+                if (bo == nullptr || !bo->isInRange(ptr))
+                    failed = true;
+            }
+        });
+    }
+
+    for (size_t i = 0; i < 200; i++) {
+        void *ptr = ctx->createMemAlloc(4096,
+                                        VPUBufferObject::Type::CachedFw,
+                                        VPUBufferObject::Location::Host);
+        if (ptr == nullptr) {
+            ADD_FAILURE() << "Failed to allocate memory";
+            break;
+        }
+        EXPECT_NE(ctx->findBufferObject(ptr), nullptr);
+        EXPECT_TRUE(ctx->freeMemAlloc(ptr));
+        EXPECT_EQ(ctx->findBufferObject(ptr), nullptr);
+    }
+
+    stop = true;
+    for (auto &reader : readers)
+        reader.join();
+    EXPECT_FALSE(failed);
+
+    for (auto *ptr : ptrs)
+        EXPECT_TRUE(ctx->freeMemAlloc(ptr));
+}
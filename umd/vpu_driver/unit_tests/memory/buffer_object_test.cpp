@@ -10,8 +10,7 @@
 #include "gtest/gtest.h"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
-#include "vpu_driver/unit_tests/mocks/mock_os_interface_imp.hpp"
-#include "vpu_driver/unit_tests/mocks/mock_vpu_device.hpp"
+#include "vpu_driver/unit_tests/fixtures/device_context_fixture.hpp"
 
 #include <memory>
 #include <string.h>
@@ -20,15 +19,7 @@
 
 using namespace VPU;
 
-struct VPUBufferObjectTest : public ::testing::Test {
-    void SetUp() {}
-
-    void TearDown() { ASSERT_EQ(ctx->getBuffersCount(), 0u); }
-
-    MockOsInterfaceImp osInfc;
-    std::unique_ptr<MockVPUDevice> vpuDevice = MockVPUDevice::createWithDefaultHardwareInfo(osInfc);
-    std::shared_ptr<VPUDeviceContext> ctx = vpuDevice->createDeviceContext();
-};
+using VPUBufferObjectTest = Test<DeviceContextFixture>;
 
 TEST_F(VPUBufferObjectTest, createBufferObject) {
     EXPECT_TRUE(VPUBufferObject::create(ctx->getDriverApi(),
@@ -97,3 +88,64 @@ TEST_F(VPUBufferObjectTest, copyToBufferNullptrDataExpectFailure) {
                                       size);
     EXPECT_FALSE(bo->copyToBuffer(nullptr, size, 0));
 }
+
+TEST_F(VPUBufferObjectTest, lazyMappedBufferIsMappedOnFirstAccess) {
+    const uint32_t mmapCount = osInfc.callCntAlloc;
+    const uint32_t munmapCount = osInfc.callCntFree;
+    auto bo = VPUBufferObject::create(ctx->getDriverApi(),
+                                      VPUBufferObject::Location::Device,
+                                      VPUBufferObject::Type::WriteCombineDma,
+                                      4096,
+                                      VPUBufferObject::Mapping::Lazy);
+    ASSERT_NE(bo, nullptr);
+    EXPECT_FALSE(bo->isMapped());
+    EXPECT_EQ(osInfc.callCntAlloc, mmapCount);
+
+    // Buffer object that is not mapped does not resolve any address, also not its VPU address
+    EXPECT_FALSE(bo->isInRange(reinterpret_cast<void *>(bo->getVPUAddr())));
+    EXPECT_EQ(bo->getVPUAddr(reinterpret_cast<void *>(bo->getVPUAddr())), 0u);
+
+    uint32_t pattern = 0xcafe;
+    EXPECT_TRUE(bo->fillBuffer(&pattern, sizeof(pattern)));
+    EXPECT_TRUE(bo->isMapped());
+    EXPECT_EQ(osInfc.callCntAlloc, mmapCount + 1);
+    EXPECT_TRUE(bo->isInRange(bo->getBasePointer() + 4095));
+    EXPECT_FALSE(bo->isInRange(bo->getBasePointer() + 4096));
+    EXPECT_EQ(bo->getVPUAddr(bo->getBasePointer() + 16), bo->getVPUAddr() + 16);
+
+    bo.reset();
+    EXPECT_EQ(osInfc.callCntFree, munmapCount + 1);
+}
+
+TEST_F(VPUBufferObjectTest, lazyMappedAllocationIsMappedBeforePointerIsReturned) {
+    const uint32_t mmapCount = osInfc.callCntAlloc;
+    void *ptr = ctx->createMemAlloc(4096,
+                                    VPUBufferObject::Type::WriteCombineDma,
+                                    VPUBufferObject::Location::Device,
+                                    VPUBufferObject::Mapping::Lazy);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(osInfc.callCntAlloc, mmapCount + 1);
+
+    auto bo = ctx->findBufferObject(static_cast<uint8_t *>(ptr) + 100);
+    ASSERT_NE(bo, nullptr);
+    EXPECT_TRUE(bo->isMapped());
+    EXPECT_EQ(bo->getBasePointer(), ptr);
+    EXPECT_EQ(ctx->findBufferObject(reinterpret_cast<void *>(bo->getVPUAddr())), nullptr);
+    bo.reset();
+
+    EXPECT_TRUE(ctx->freeMemAlloc(ptr));
+    EXPECT_EQ(ctx->findBufferObject(ptr), nullptr);
+}
+
+TEST_F(VPUBufferObjectTest, populatedBufferIsMappedAtCreation) {
+    auto bo = VPUBufferObject::create(ctx->getDriverApi(),
+                                      VPUBufferObject::Location::Host,
+                                      VPUBufferObject::Type::CachedDma,
+                                      4 * 4096,
+                                      VPUBufferObject::Mapping::Populate);
+    ASSERT_NE(bo, nullptr);
+    EXPECT_TRUE(bo->isMapped());
+
+    std::vector<uint8_t> zeros(bo->getAllocSize(), 0);
+    EXPECT_EQ(memcmp(zeros.data(), bo->getBasePointer(), bo->getAllocSize()), 0);
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/memory/vpu_shared_buffers.hpp"
+#include "vpu_driver/source/utilities/sha256.hpp"
+#include "vpu_driver/unit_tests/fixtures/device_context_fixture.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace VPU;
+
+using VPUSharedBuffersTest = Test<DeviceContextFixture>;
+
+TEST_F(VPUSharedBuffersTest, keyDependsOnContentSizeAndAttributes) {
+    std::vector<uint8_t> content(8192, 0xab);
+    auto key = VPUSharedBuffers::makeKey(content.data(), content.size(), 1);
+
+    auto sameKey = VPUSharedBuffers::makeKey(content.data(), content.size(), 1);
+    EXPECT_FALSE(key < sameKey || sameKey < key);
+
+    auto otherAttributes = VPUSharedBuffers::makeKey(content.data(), content.size(), 2);
+    EXPECT_TRUE(key < otherAttributes || otherAttributes < key);
+
+    auto otherSize = VPUSharedBuffers::makeKey(content.data(), 4096, 1);
+    EXPECT_TRUE(key < otherSize || otherSize < key);
+
+    content[100] = 0;
+    auto otherContent = VPUSharedBuffers::makeKey(content.data(), content.size(), 1);
+    EXPECT_TRUE(key < otherContent || otherContent < key);
+}
+
+TEST_F(VPUSharedBuffersTest, keyOfContentHashedInChunksMatchesKeyOfWholeContent) {
+    std::vector<uint8_t> content(VPUSharedBuffers::hashChunkSize * 2 + 100);
+    for (size_t i = 0; i < content.size(); i++)
+        content[i] = static_cast<uint8_t>(i * 7);
+
+    // Parts are hashed in reverse order, the hashes are combined in content order
+    std::vector<HashSha256::Digest> chunkHashes(3);
+    for (size_t i = chunkHashes.size(); i-- > 0;) {
+        size_t offset = i * VPUSharedBuffers::hashChunkSize;
+        size_t size = std::min(VPUSharedBuffers::hashChunkSize, content.size() - offset);
+        chunkHashes[i] = VPUSharedBuffers::hashChunk(content.data() + offset, size);
+    }
+    VPUSharedBuffers::Key chunked = {VPUSharedBuffers::combineHashes(chunkHashes),
+                                     content.size(),
+                                     1};
+
+    auto key = VPUSharedBuffers::makeKey(content.data(), content.size(), 1);
+    EXPECT_FALSE(key < chunked || chunked < key);
+}
+
+class HashSha256Test : public testing::TestWithParam<std::pair<std::string, const char *>> {};
+
+INSTANTIATE_TEST_SUITE_P(,
+                         HashSha256Test,
+                         ::testing::ValuesIn(std::vector<std::pair<std::string, const char *>>{
+                             {"",
+                              "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+                             {"abc",
+                              "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+                             {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+                              "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+                             {std::string(1000000, 'a'),
+                              "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"},
+                         }));
+
+TEST_P(HashSha256Test, ComputeHash) {
+    auto [input, expected] = GetParam();
+
+    // Content passed in uneven parts gives the same digest
+    HashSha256 hash;
+    for (size_t offset = 0; offset < input.size(); offset += 61)
+        hash.update(input.data() + offset, std::min<size_t>(61, input.size() - offset));
+
+    std::string digest;
+    for (auto byte : hash.final()) {
+        char hex[3];
+        snprintf(hex, sizeof(hex), "%02x", byte);
+        digest += hex;
+    }
+    EXPECT_EQ(expected, digest);
+}
+
+TEST_F(VPUSharedBuffersTest, publishedBufferIsReusedUntilLastUserDropsIt) {
+    VPUSharedBuffers shared;
+    std::vector<uint8_t> content(4096, 0x5a);
+    auto key = VPUSharedBuffers::makeKey(content.data(), content.size(), 0);
+
+    EXPECT_EQ(shared.find(key), nullptr);
+
+    auto bo = createBo(content.size(), VPUBufferObject::Type::WriteCombineDma);
+    ASSERT_NE(bo, nullptr);
+    auto *rawBo = bo.get();
+    EXPECT_EQ(shared.add(key, bo).get(), rawBo);
+    EXPECT_EQ(shared.getStats().count, 1u);
+    EXPECT_EQ(shared.getStats().savedSize, 0u);
+
+    auto reused = shared.find(key);
+    EXPECT_EQ(reused.get(), rawBo);
+    auto copy = reused;
+    EXPECT_EQ(shared.getStats().savedSize, 4096u);
+
+    // Concurrent upload of the same content gets the published buffer
+    auto duplicate = createBo(content.size(), VPUBufferObject::Type::WriteCombineDma);
+    ASSERT_NE(duplicate, nullptr);
+    auto raced = shared.add(key, std::move(duplicate));
+    EXPECT_EQ(raced.get(), rawBo);
+    EXPECT_EQ(shared.getStats().savedSize, 8192u);
+
+    raced.reset();
+    reused.reset();
+    EXPECT_EQ(shared.getStats().savedSize, 4096u);
+    copy.reset();
+    EXPECT_EQ(shared.getStats().savedSize, 0u);
+
+    // Buffer is released with its last user
+    bo.reset();
+    EXPECT_EQ(shared.find(key), nullptr);
+    EXPECT_EQ(shared.getStats().count, 0u);
+    EXPECT_EQ(shared.getStats().size, 0u);
+}
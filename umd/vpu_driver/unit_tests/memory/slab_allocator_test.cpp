@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/memory/vpu_slab_allocator.hpp"
+#include "vpu_driver/unit_tests/fixtures/device_context_fixture.hpp"
+
+#include <memory>
+#include <string.h>
+#include <vector>
+
+using namespace VPU;
+
+struct VPUSlabAllocatorTest : public Test<DeviceContextFixture> {
+    VPUSlabAllocator allocator{ctx.get()};
+};
+
+TEST_F(VPUSlabAllocatorTest, smallChunksShareBufferObject) {
+    auto chunk0 = allocator.allocate(8, VPUBufferObject::Type::CachedFw);
+    auto chunk1 = allocator.allocate(100, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(chunk0, nullptr);
+    ASSERT_NE(chunk1, nullptr);
+
+    EXPECT_EQ(chunk0->getAllocSize(), 64u);
+    EXPECT_EQ(chunk1->getAllocSize(), 128u);
+    EXPECT_EQ(chunk0->getBufferObject()->getHandle(), chunk1->getBufferObject()->getHandle());
+    EXPECT_EQ(chunk0->getVPUAddr() % VPUSlabAllocator::chunkAlignment, 0u);
+    EXPECT_EQ(chunk1->getVPUAddr() % VPUSlabAllocator::chunkAlignment, 0u);
+    EXPECT_FALSE(chunk0->isInRange(chunk1->getBasePointer()));
+    EXPECT_EQ(chunk1->getVPUAddr(chunk1->getBasePointer() + 8), chunk1->getVPUAddr() + 8);
+    EXPECT_EQ(allocator.getSlabsCount(), 1u);
+    EXPECT_EQ(ctx->getBuffersCount(), 1u);
+}
+
+TEST_F(VPUSlabAllocatorTest, differentTypesUseSeparateSlabs) {
+    auto chunk0 = allocator.allocate(64, VPUBufferObject::Type::CachedFw);
+    auto chunk1 = allocator.allocate(64, VPUBufferObject::Type::WriteCombineFw);
+    ASSERT_NE(chunk0, nullptr);
+    ASSERT_NE(chunk1, nullptr);
+
+    EXPECT_NE(chunk0->getBufferObject()->getHandle(), chunk1->getBufferObject()->getHandle());
+    EXPECT_EQ(allocator.getSlabsCount(), 2u);
+}
+
+TEST_F(VPUSlabAllocatorTest, freedChunkIsReusedAndCleared) {
+    auto chunk0 = allocator.allocate(64, VPUBufferObject::Type::CachedFw);
+    auto chunk1 = allocator.allocate(64, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(chunk0, nullptr);
+    ASSERT_NE(chunk1, nullptr);
+
+    auto *ptr = chunk0->getBasePointer();
+    memset(ptr, 0xab, chunk0->getAllocSize());
+    chunk0.reset();
+
+    chunk0 = allocator.allocate(32, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(chunk0, nullptr);
+    EXPECT_EQ(chunk0->getBasePointer(), ptr);
+    for (size_t i = 0; i < chunk0->getAllocSize(); i++)
+        ASSERT_EQ(ptr[i], 0u);
+}
+
+TEST_F(VPUSlabAllocatorTest, bufferObjectKeepsChunkAlive) {
+    auto chunk = allocator.allocate(64, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(chunk, nullptr);
+    auto *ptr = chunk->getBasePointer();
+
+    auto bo = chunk->getBufferObject();
+    chunk.reset();
+    EXPECT_TRUE(bo->isInRange(ptr));
+
+    auto otherChunk = allocator.allocate(64, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(otherChunk, nullptr);
+    EXPECT_NE(otherChunk->getBasePointer(), ptr);
+}
+
+TEST_F(VPUSlabAllocatorTest, slabIsReleasedWithLastChunk) {
+    std::vector<std::shared_ptr<VPUBufferChunk>> chunks;
+    size_t chunksPerSlab = VPUSlabAllocator::slabSize / VPUSlabAllocator::chunkAlignment;
+    for (size_t i = 0; i < chunksPerSlab + 1; i++) {
+        chunks.push_back(allocator.allocate(64, VPUBufferObject::Type::CachedFw));
+        ASSERT_NE(chunks.back(), nullptr);
+    }
+    EXPECT_EQ(allocator.getSlabsCount(), 2u);
+
+    chunks.pop_back();
+    EXPECT_EQ(allocator.getSlabsCount(), 1u);
+
+    chunks.clear();
+    EXPECT_EQ(allocator.getSlabsCount(), 0u);
+}
+
+TEST_F(VPUSlabAllocatorTest, largeChunkGetsDedicatedSlab) {
+    auto chunk =
+        allocator.allocate(VPUSlabAllocator::slabSize + 1, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(chunk, nullptr);
+    EXPECT_EQ(chunk->getOffset(), 0u);
+    EXPECT_GE(chunk->getBufferObject()->getAllocSize(), VPUSlabAllocator::slabSize + 1);
+}
+
+TEST_F(VPUSlabAllocatorTest, zeroSizeIsRejected) {
+    EXPECT_EQ(allocator.allocate(0, VPUBufferObject::Type::CachedFw), nullptr);
+}
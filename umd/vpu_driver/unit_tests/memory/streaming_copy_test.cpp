@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/memory/vpu_streaming_copy.hpp"
+
+#include <string.h>
+#include <vector>
+
+using namespace VPU;
+
+TEST(VPUStreamingCopyTest, copyMatchesMemcpyForUnalignedRanges) {
+    std::vector<uint8_t> src(64 * 1024);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<uint8_t>(i * 31 + 7);
+
+    for (size_t size : {0u, 1u, 63u, 255u, 256u, 257u, 4096u, 4099u, 60000u}) {
+        for (size_t offset : {0u, 1u, 17u, 32u, 63u}) {
+            std::vector<uint8_t> dst(size + 128, 0);
+            std::vector<uint8_t> ref(size + 128, 0);
+            streamingCopy(dst.data() + offset, src.data() + 3, size);
+            memcpy(ref.data() + offset, src.data() + 3, size);
+            EXPECT_EQ(dst, ref) << "size: " << size << ", offset: " << offset;
+        }
+    }
+}
+
+TEST(VPUStreamingCopyTest, fillWritesPatternWithinRange) {
+    const uint32_t pattern = 0x11223344;
+    for (size_t patternSize : {1u, 2u, 4u}) {
+        for (size_t size : {0u, 4u, 60u, 256u, 260u, 4096u, 65540u}) {
+            for (size_t offset : {0u, 4u, 36u}) {
+                std::vector<uint8_t> dst(size + 128, 0);
+                std::vector<uint8_t> ref(size + 128, 0);
+                streamingFill(dst.data() + offset, &pattern, patternSize, size);
+                for (size_t i = 0; i < size; i += patternSize)
+                    memcpy(ref.data() + offset + i, &pattern, patternSize);
+                EXPECT_EQ(dst, ref) << "pattern size: " << patternSize << ", size: " << size
+                                    << ", offset: " << offset;
+            }
+        }
+    }
+}
@@ -16,6 +16,7 @@ namespace VPU {
 class GMockOsFileImp : public OsFile {
   public:
     MOCK_METHOD(bool, write, (const void *, size_t), (override));
+    MOCK_METHOD(bool, read, (void *, size_t, size_t), (override));
     MOCK_METHOD(void *, mmap, (), (override));
     MOCK_METHOD(size_t, size, (), (override));
 };
@@ -112,22 +112,39 @@ int MockOsInterfaceImp::osiIoctl(int fd, unsigned int request, void *data) {
         }
 
         auto *args = static_cast<struct drm_ivpu_bo_create *>(data);
+        args->handle = ++lastBoHandle;
         args->vpu_addr = deviceAddress;
         deviceAddress += ALIGN(args->size, osiGetSystemPageSize());
     } else if (request == DRM_IOCTL_IVPU_BO_INFO) {
         auto *args = static_cast<struct drm_ivpu_bo_info *>(data);
         args->mmap_offset = 100u;
 
-    } else if (request == DRM_IOCTL_IVPU_SUBMIT) {
+    } else if (request == DRM_IOCTL_IVPU_SUBMIT || request == DRM_IOCTL_IVPU_CMDQ_SUBMIT) {
         callCntSubmit++;
+        const uint32_t *handles = nullptr;
+        uint32_t handleCount = 0;
+        if (request == DRM_IOCTL_IVPU_SUBMIT) {
+            auto *args = static_cast<struct drm_ivpu_submit *>(data);
+            handles = reinterpret_cast<const uint32_t *>(args->buffers_ptr);
+            handleCount = args->buffer_count;
+        } else {
+            auto *args = static_cast<struct drm_ivpu_cmdq_submit *>(data);
+            handles = reinterpret_cast<const uint32_t *>(args->buffers_ptr);
+            handleCount = args->buffer_count;
+        }
+        submittedBufferHandles.assign(handles, handles + handleCount);
+        if (submitBusyCount > 0) {
+            submitBusyCount--;
+            errno = EBUSY;
+            return -1;
+        }
     } else if (request == DRM_IOCTL_IVPU_CMDQ_CREATE) {
         callCntSubmit++;
-    } else if (request == DRM_IOCTL_IVPU_CMDQ_SUBMIT) {
-        callCntSubmit++;
     } else if (request == DRM_IOCTL_IVPU_CMDQ_DESTROY) {
         callCntSubmit++;
     } else if (request == DRM_IOCTL_IVPU_BO_WAIT) {
-        bool timeout = waitFailed.test(0);
+        callCntWait++;
+        bool timeout = waitFailed.test(0) || waitBusy;
         waitFailed >>= 1;
         if (timeout) {
             errno = ETIMEDOUT;
@@ -231,6 +248,9 @@ MockOsInterfaceImp::osiMmap(void *addr, size_t size, int prot, int flags, int fd
     if (posix_memalign(&ptr, osiGetSystemPageSize(), size))
         return nullptr;
 
+    // Kernel provides zeroed pages for new mapping
+    memset(ptr, 0, size);
+
     callCntAlloc++;
     return ptr;
 }
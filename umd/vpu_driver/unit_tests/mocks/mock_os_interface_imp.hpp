@@ -17,6 +17,7 @@
 #include <memory>
 #include <string>
 #include <sys/types.h>
+#include <vector>
 
 namespace VPU {
 class MockOsInterfaceImp : public OsInterface {
@@ -34,10 +35,18 @@ class MockOsInterfaceImp : public OsInterface {
     uint32_t callCntFree = 0;
     uint32_t callCntIoctl = 0;
     uint32_t callCntSubmit = 0;
+    uint32_t callCntWait = 0;
+    // Number of next submits rejected with EBUSY
+    uint32_t submitBusyCount = 0;
+    // Buffer handles passed to the last submit
+    std::vector<uint32_t> submittedBufferHandles;
+    // Every job wait times out as if the jobs were still running
+    bool waitBusy = false;
 
     unsigned long ioctlLastCommand = 0;
     int fd = 3;
     uint64_t deviceAddress = 0xc000'0000;
+    uint32_t lastBoHandle = 0;
     uint64_t unique_id = 0;
 
     int32_t kmdApiVersionMajor = 1;
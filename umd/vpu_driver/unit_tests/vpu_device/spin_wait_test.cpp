@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/utilities/spin_wait.hpp"
+
+#include <chrono> // IWYU pragma: keep
+#include <limits>
+#include <stdlib.h>
+#include <thread>
+
+using namespace VPU;
+
+static int64_t infiniteTimeout() {
+    return std::numeric_limits<int64_t>::max();
+}
+
+struct SpinWaitTest : public ::testing::Test {
+    void SetUp() override { savedConfig = SpinWait::getConfig(); }
+    void TearDown() override { SpinWait::setConfig(savedConfig); }
+
+    SpinWait::Config savedConfig;
+};
+
+TEST_F(SpinWaitTest, configIsReadFromEnvironment) {
+    ASSERT_EQ(setenv("ZE_INTEL_NPU_WAIT_SPIN_US", "150", 1), 0);
+    ASSERT_EQ(setenv("ZE_INTEL_NPU_WAIT_RELAX", "umwait", 1), 0);
+    auto config = SpinWait::getConfigFromEnv();
+    EXPECT_EQ(std::chrono::microseconds(150), config.spinTime);
+    EXPECT_EQ(SpinWait::Relax::UMWAIT, config.relax);
+
+    // Invalid values keep defaults
+    ASSERT_EQ(setenv("ZE_INTEL_NPU_WAIT_SPIN_US", "abc", 1), 0);
+    ASSERT_EQ(setenv("ZE_INTEL_NPU_WAIT_RELAX", "sleep", 1), 0);
+    config = SpinWait::getConfigFromEnv();
+    EXPECT_EQ(SpinWait::Config().spinTime, config.spinTime);
+    EXPECT_EQ(SpinWait::Config().relax, config.relax);
+
+    ASSERT_EQ(setenv("ZE_INTEL_NPU_WAIT_SPIN_US", "-5", 1), 0);
+    config = SpinWait::getConfigFromEnv();
+    EXPECT_EQ(SpinWait::Config().spinTime, config.spinTime);
+
+    unsetenv("ZE_INTEL_NPU_WAIT_SPIN_US");
+    unsetenv("ZE_INTEL_NPU_WAIT_RELAX");
+}
+
+TEST_F(SpinWaitTest, spinEndsOnValueSpinTimeOrTimeout) {
+    volatile uint64_t value = 1;
+    auto isTwo = [](uint64_t v) { return v == 2; };
+
+    SpinWait::Config config;
+    config.spinTime = std::chrono::microseconds(0);
+    SpinWait::setConfig(config);
+    EXPECT_FALSE(SpinWait::spinUntil(&value, isTwo, infiniteTimeout()));
+    value = 2;
+    EXPECT_TRUE(SpinWait::spinUntil(&value, isTwo, infiniteTimeout()));
+
+    value = 1;
+    config.spinTime = std::chrono::seconds(10);
+    SpinWait::setConfig(config);
+    EXPECT_FALSE(SpinWait::spinUntil(&value, isTwo, 0));
+
+    for (auto relax : {SpinWait::Relax::YIELD, SpinWait::Relax::PAUSE, SpinWait::Relax::UMWAIT}) {
+        value = 1;
+        config.relax = relax;
+        SpinWait::setConfig(config);
+        std::thread writer([&] { value = 2; });
+        EXPECT_TRUE(SpinWait::spinUntil(&value, isTwo, infiniteTimeout()));
+        writer.join();
+    }
+}
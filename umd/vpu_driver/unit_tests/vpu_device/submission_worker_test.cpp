@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/command/vpu_event_command.hpp"
+#include "vpu_driver/source/command/vpu_job.hpp"
+#include "vpu_driver/source/command/vpu_ts_command.hpp"
+#include "vpu_driver/source/device/vpu_command_queue.hpp"
+#include "vpu_driver/source/device/vpu_submission_worker.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/utilities/mpsc_ring.hpp"
+#include "vpu_driver/unit_tests/mocks/mock_os_interface_imp.hpp"
+#include "vpu_driver/unit_tests/mocks/mock_vpu_device.hpp"
+
+#include <chrono> // IWYU pragma: keep
+#include <errno.h>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace VPU;
+
+struct VPUSubmissionWorkerTest : public ::testing::Test {
+    void SetUp() {
+        tsDest = ctx->createSharedMemAlloc(4096);
+        ASSERT_NE(nullptr, tsDest);
+    }
+
+    void TearDown() {
+        EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
+        queue.reset();
+        ASSERT_EQ(ctx->getBuffersCount(), 0u);
+    }
+
+    std::shared_ptr<VPUJob> createJob() {
+        auto job = std::make_shared<VPUJob>(ctx.get());
+        EXPECT_TRUE(job->appendCommand(
+            VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsDest->getBasePointer()),
+                                        tsDest)));
+        EXPECT_TRUE(job->closeCommands());
+        return job;
+    }
+
+    static int64_t infiniteTimeout() { return std::numeric_limits<int64_t>::max(); }
+
+    MockOsInterfaceImp osInfc;
+    std::unique_ptr<MockVPUDevice> vpuDevice = MockVPUDevice::createWithDefaultHardwareInfo(osInfc);
+    std::shared_ptr<MockVPUDeviceContext> ctx = vpuDevice->createMockDeviceContext();
+    std::unique_ptr<VPUDeviceQueue> queue =
+        VPUDeviceQueue::create(ctx.get(), VPUDeviceQueue::Priority::NORMAL, false);
+    std::shared_ptr<VPUBufferObject> tsDest;
+};
+
+TEST(MpscRingTest, popsValuesInPushOrderAndReportsFullRing) {
+    MpscRing<int> ring(3);
+    EXPECT_EQ(4u, ring.capacity());
+    EXPECT_TRUE(ring.empty());
+
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(ring.tryPush(int(i)));
+    EXPECT_FALSE(ring.tryPush(4));
+
+    int value = -1;
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(ring.tryPop(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(ring.tryPop(value));
+    EXPECT_TRUE(ring.empty());
+
+    // Wrap around
+    EXPECT_TRUE(ring.tryPush(5));
+    EXPECT_TRUE(ring.tryPop(value));
+    EXPECT_EQ(5, value);
+}
+
+TEST_F(VPUSubmissionWorkerTest, jobWaitBlocksUntilJobIsSubmitted) {
+    auto job = createJob();
+    osInfc.callCntSubmit = 0;
+
+    {
+        VPUSubmissionWorker worker(*queue);
+        worker.enqueue(job);
+
+        EXPECT_TRUE(job->waitForCompletion(infiniteTimeout()));
+        EXPECT_EQ(1u, osInfc.callCntSubmit);
+        EXPECT_TRUE(job->isSuccess());
+    }
+}
+
+TEST_F(VPUSubmissionWorkerTest, jobsFromManyThreadsAreAllSubmitted) {
+    constexpr size_t threadCount = 4;
+    constexpr size_t jobsPerThread = 64;
+
+    std::vector<std::shared_ptr<VPUJob>> jobs;
+    for (size_t i = 0; i < threadCount * jobsPerThread; i++)
+        jobs.push_back(createJob());
+    osInfc.callCntSubmit = 0;
+
+    {
+        // Small ring forces producers to wait for the worker
+        VPUSubmissionWorker worker(*queue, 8);
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; t++) {
+            threads.emplace_back([&, t] {
+                for (size_t i = 0; i < jobsPerThread; i++)
+                    worker.enqueue(jobs[t * jobsPerThread + i]);
+            });
+        }
+        for (auto &thread : threads)
+            thread.join();
+
+        for (auto &job : jobs)
+            EXPECT_TRUE(job->waitForCompletion(infiniteTimeout()));
+
+        auto stats = worker.getStats();
+        EXPECT_EQ(threadCount * jobsPerThread, stats.submitted);
+        EXPECT_EQ(0u, stats.failed);
+        EXPECT_EQ(0u, stats.depth);
+        EXPECT_GE(stats.batches, 1u);
+        EXPECT_LE(stats.batches, stats.submitted);
+    }
+
+    EXPECT_EQ(threadCount * jobsPerThread, osInfc.callCntSubmit);
+}
+
+TEST_F(VPUSubmissionWorkerTest, failedSubmissionIsReportedByJob) {
+    auto job = createJob();
+
+    VPUDeviceQueue::SubmitRetryConfig config;
+    config.timeout = std::chrono::milliseconds(0);
+    queue->setSubmitRetryConfig(config);
+    osInfc.submitBusyCount = UINT32_MAX;
+
+    {
+        VPUSubmissionWorker worker(*queue);
+        worker.enqueue(job);
+
+        EXPECT_TRUE(job->waitForCompletion(infiniteTimeout()));
+        EXPECT_FALSE(job->isSuccess());
+        EXPECT_EQ(EBUSY, job->getSubmitError());
+        EXPECT_EQ(1u, worker.getStats().failed);
+    }
+    osInfc.submitBusyCount = 0;
+}
+
+TEST_F(VPUSubmissionWorkerTest, failedSubmissionFailsJobsOrderedAfterIt) {
+    auto createOrderedJob = [this](std::shared_ptr<VPUJob> precedingJob) {
+        auto job = std::make_shared<VPUJob>(ctx.get());
+        job->setPrecedingJob(std::move(precedingJob));
+        EXPECT_TRUE(job->appendCommand(
+            VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsDest->getBasePointer()),
+                                        tsDest)));
+        EXPECT_TRUE(job->closeCommands());
+        return job;
+    };
+    auto firstJob = createOrderedJob(nullptr);
+    auto nextJob = createOrderedJob(firstJob);
+    auto *fence = firstJob->getCompletionFence();
+    ASSERT_NE(nullptr, fence);
+
+    VPUDeviceQueue::SubmitRetryConfig config;
+    config.timeout = std::chrono::milliseconds(0);
+    queue->setSubmitRetryConfig(config);
+    osInfc.submitBusyCount = 1;
+
+    {
+        VPUSubmissionWorker worker(*queue);
+        worker.enqueue(firstJob);
+        worker.enqueue(nextJob);
+        EXPECT_TRUE(nextJob->waitForCompletion(infiniteTimeout()));
+        EXPECT_EQ(2u, worker.getStats().failed);
+    }
+    osInfc.submitBusyCount = 0;
+
+    // Next job would wait on the device for the fence that is never signaled
+    EXPECT_EQ(1u, osInfc.callCntSubmit);
+    EXPECT_EQ(0u, *fence);
+    EXPECT_FALSE(nextJob->isSuccess());
+    EXPECT_EQ(EBUSY, nextJob->getSubmitError());
+    EXPECT_EQ(nullptr, nextJob->takePrecedingJob());
+}
+
+TEST_F(VPUSubmissionWorkerTest, drainReturnsWhenQueuedJobsAreSubmitted) {
+    constexpr size_t jobCount = 16;
+
+    std::vector<std::shared_ptr<VPUJob>> jobs;
+    for (size_t i = 0; i < jobCount; i++)
+        jobs.push_back(createJob());
+
+    VPUSubmissionWorker worker(*queue);
+    for (auto &job : jobs)
+        worker.enqueue(job);
+    worker.drain();
+
+    EXPECT_EQ(jobCount, worker.getStats().submitted);
+    EXPECT_EQ(jobCount, osInfc.callCntSubmit);
+    for (auto &job : jobs)
+        EXPECT_TRUE(job->waitForSubmit(0));
+}
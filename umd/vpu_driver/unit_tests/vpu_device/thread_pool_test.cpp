@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/utilities/thread_pool.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace VPU;
+
+TEST(ThreadPoolTest, destructorRunsAllQueuedTasks) {
+    constexpr size_t taskCount = 256;
+    std::atomic<size_t> done = 0;
+
+    {
+        ThreadPool pool(4);
+        EXPECT_EQ(4u, pool.getThreadCount());
+        for (size_t i = 0; i < taskCount; i++)
+            pool.enqueue([&done] { done++; });
+    }
+
+    EXPECT_EQ(taskCount, done.load());
+}
+
+TEST(ThreadPoolTest, tasksRunOutsideOfCallingThread) {
+    std::mutex mtx;
+    std::condition_variable condition;
+    bool finished = false;
+    std::thread::id taskThread;
+
+    ThreadPool pool(1);
+    pool.enqueue([&] {
+        const std::lock_guard<std::mutex> lock(mtx);
+        taskThread = std::this_thread::get_id();
+        finished = true;
+        condition.notify_one();
+    });
+
+    std::unique_lock<std::mutex> lock(mtx);
+    condition.wait(lock, [&] { return finished; });
+    EXPECT_NE(std::this_thread::get_id(), taskThread);
+}
+
+TEST(ThreadPoolTest, poolWithoutThreadsRunsTaskInEnqueue) {
+    ThreadPool pool(0);
+    EXPECT_EQ(0u, pool.getThreadCount());
+
+    bool done = false;
+    pool.enqueue([&done] { done = true; });
+    EXPECT_TRUE(done);
+}
+
+TEST(ThreadPoolTest, runParallelRunsEveryIndexOnce) {
+    constexpr size_t count = 1000;
+    std::vector<std::atomic<uint32_t>> runs(count);
+
+    ThreadPool pool(4);
+    pool.runParallel(count, 8, [&runs](size_t i) { runs[i]++; });
+
+    for (size_t i = 0; i < count; i++)
+        EXPECT_EQ(1u, runs[i].load()) << "index " << i;
+}
+
+TEST(ThreadPoolTest, runParallelCompletesFromBusyPool) {
+    constexpr size_t count = 100;
+    std::atomic<size_t> done = 0;
+    std::mutex mtx;
+    std::condition_variable condition;
+    bool finished = false;
+
+    // The only pool thread runs the call, the helpers queued by it cannot start before it returns
+    ThreadPool pool(1);
+    pool.enqueue([&] {
+        pool.runParallel(count, 4, [&done](size_t) { done++; });
+        const std::lock_guard<std::mutex> lock(mtx);
+        finished = true;
+        condition.notify_one();
+    });
+
+    std::unique_lock<std::mutex> lock(mtx);
+    condition.wait(lock, [&] { return finished; });
+    EXPECT_EQ(count, done.load());
+}
+
+TEST(ThreadPoolTest, runParallelWithoutThreadsRunsOnCallingThread) {
+    ThreadPool pool(0);
+    std::vector<std::thread::id> ids(16);
+
+    pool.runParallel(ids.size(), 4, [&ids](size_t i) { ids[i] = std::this_thread::get_id(); });
+
+    for (const auto &id : ids)
+        EXPECT_EQ(std::this_thread::get_id(), id);
+}
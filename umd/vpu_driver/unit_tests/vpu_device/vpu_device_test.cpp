@@ -5,19 +5,26 @@
  *
  */
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "gtest/gtest.h"
+#include "vpu_driver/source/command/vpu_command_buffer.hpp"
 #include "vpu_driver/source/command/vpu_job.hpp"
 #include "vpu_driver/source/command/vpu_ts_command.hpp"
 #include "vpu_driver/source/device/metric_info.hpp"
 #include "vpu_driver/source/device/vpu_command_queue.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/utilities/spin_wait.hpp"
 #include "vpu_driver/unit_tests/mocks/mock_os_interface_imp.hpp"
 #include "vpu_driver/unit_tests/mocks/mock_vpu_device.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace VPU;
@@ -25,13 +32,32 @@ using namespace VPU;
 struct VPUDeviceTest : public ::testing::Test {
     void SetUp() {}
 
-    void TearDown() { ASSERT_EQ(ctx->getBuffersCount(), 0u); }
+    void TearDown() {
+        // Queue keeps the timeline fence after the first submission
+        queue.reset();
+        ASSERT_EQ(ctx->getBuffersCount(), 0u);
+    }
 
     MockOsInterfaceImp osInfc;
     std::unique_ptr<MockVPUDevice> vpuDevice = MockVPUDevice::createWithDefaultHardwareInfo(osInfc);
     std::shared_ptr<MockVPUDeviceContext> ctx = vpuDevice->createMockDeviceContext();
     std::unique_ptr<VPUDeviceQueue> queue =
         VPUDeviceQueue::create(ctx.get(), VPUDeviceQueue::Priority::NORMAL, false);
+
+    std::unique_ptr<VPUJob> createJob(const std::shared_ptr<VPUBufferObject> &tsDest) {
+        auto job = std::make_unique<VPUJob>(ctx.get());
+        EXPECT_TRUE(job->appendCommand(
+            VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsDest->getBasePointer()),
+                                        tsDest)));
+        EXPECT_TRUE(job->closeCommands());
+        return job;
+    }
+
+    static const vpu_cmd_fence_t *getTimelineSignal(const VPUCommandBuffer &cmdBuffer) {
+        auto *header = reinterpret_cast<const vpu_cmd_buffer_header_t *>(cmdBuffer.getBufferPtr());
+        return reinterpret_cast<const vpu_cmd_fence_t *>(
+            cmdBuffer.getBufferPtr() + header->cmd_buffer_size - sizeof(vpu_cmd_fence_t));
+    }
 };
 
 TEST_F(VPUDeviceTest, jobSubmissionTriggersIoctls) {
@@ -53,9 +79,200 @@ TEST_F(VPUDeviceTest, jobSubmissionTriggersIoctls) {
     // Ioctls:
     // * createSharedMemAlloc calls BO_CREATE and BO_INFO
     // * allocateJob calls BO_CREATE and BO_INFO
-    // * submitJob calls SUBMIT
-    EXPECT_EQ(5u, osInfc.callCntIoctl);
+    // * submitJob calls BO_CREATE and BO_INFO for timeline fence and SUBMIT
+    EXPECT_EQ(7u, osInfc.callCntIoctl);
+
+    EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
+}
+
+TEST_F(VPUDeviceTest, busySubmitWaitsForOldestCommandBufferInFlight) {
+    auto tsDest = ctx->createSharedMemAlloc(4096);
+    ASSERT_NE(nullptr, tsDest);
+
+    std::vector<std::unique_ptr<VPUJob>> jobs;
+    for (int i = 0; i < 2; i++) {
+        jobs.push_back(std::make_unique<VPUJob>(ctx.get()));
+        EXPECT_TRUE(jobs.back()->appendCommand(
+            VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsDest->getBasePointer()),
+                                        tsDest)));
+        EXPECT_TRUE(jobs.back()->closeCommands());
+    }
+
+    EXPECT_TRUE(queue->submit(jobs[0].get()));
+
+    // First retry waits for the job in flight, second one has nothing to wait for and sleeps
+    osInfc.submitBusyCount = 2;
+    osInfc.callCntWait = 0;
+    EXPECT_TRUE(queue->submit(jobs[1].get()));
+    EXPECT_EQ(1u, osInfc.callCntWait);
+
+    auto stats = queue->getSubmitRetryStats();
+    EXPECT_EQ(2u, stats.busyCount);
+    EXPECT_EQ(1u, stats.completionWaits);
+    EXPECT_EQ(1u, stats.backoffSleeps);
+    EXPECT_EQ(0u, stats.timeouts);
+
+    jobs.clear();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
+}
+
+TEST_F(VPUDeviceTest, busySubmitUsesBackoffWhenCompletionWaitIsDisabled) {
+    auto tsDest = ctx->createSharedMemAlloc(4096);
+    ASSERT_NE(nullptr, tsDest);
+
+    auto job = std::make_unique<VPUJob>(ctx.get());
+    EXPECT_TRUE(job->appendCommand(
+        VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsDest->getBasePointer()),
+                                    tsDest)));
+    EXPECT_TRUE(job->closeCommands());
+    EXPECT_TRUE(queue->submit(job.get()));
+
+    VPUDeviceQueue::SubmitRetryConfig config;
+    config.waitForCompletion = false;
+    queue->setSubmitRetryConfig(config);
+
+    osInfc.submitBusyCount = 3;
+    osInfc.callCntWait = 0;
+    EXPECT_TRUE(queue->submit(job.get()));
+    EXPECT_EQ(0u, osInfc.callCntWait);
+
+    auto stats = queue->getSubmitRetryStats();
+    EXPECT_EQ(3u, stats.busyCount);
+    EXPECT_EQ(0u, stats.completionWaits);
+    EXPECT_EQ(3u, stats.backoffSleeps);
+
+    job.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
+}
+
+TEST_F(VPUDeviceTest, busySubmitFailsAfterTimeout) {
+    auto tsDest = ctx->createSharedMemAlloc(4096);
+    ASSERT_NE(nullptr, tsDest);
+
+    auto job = std::make_unique<VPUJob>(ctx.get());
+    EXPECT_TRUE(job->appendCommand(
+        VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsDest->getBasePointer()),
+                                    tsDest)));
+    EXPECT_TRUE(job->closeCommands());
+
+    VPUDeviceQueue::SubmitRetryConfig config;
+    config.timeout = std::chrono::milliseconds(0);
+    queue->setSubmitRetryConfig(config);
+
+    osInfc.submitBusyCount = UINT32_MAX;
+    EXPECT_FALSE(queue->submit(job.get()));
+    osInfc.submitBusyCount = 0;
+
+    auto stats = queue->getSubmitRetryStats();
+    EXPECT_EQ(1u, stats.busyCount);
+    EXPECT_EQ(1u, stats.timeouts);
+
+    job.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
+}
+
+TEST_F(VPUDeviceTest, submissionsAreTrackedByQueueTimelineFence) {
+    auto tsDest = ctx->createSharedMemAlloc(4096);
+    ASSERT_NE(nullptr, tsDest);
+
+    std::vector<std::unique_ptr<VPUJob>> jobs;
+    for (int i = 0; i < 2; i++) {
+        jobs.push_back(createJob(tsDest));
+        EXPECT_TRUE(queue->submit(jobs.back().get()));
+        ASSERT_TRUE(jobs.back()->isTimelineTracked());
+        EXPECT_EQ(static_cast<uint64_t>(i + 1), jobs.back()->getTimelineValue());
+    }
+    EXPECT_EQ(2u, queue->getTimelineValue());
+
+    auto *fence = jobs[0]->getTimelineFence();
+    ASSERT_NE(nullptr, fence);
+    EXPECT_EQ(fence, jobs[1]->getTimelineFence());
+
+    auto *signal = getTimelineSignal(*jobs[1]->getCommandBuffers()[0]);
+    EXPECT_EQ(VPU_CMD_FENCE_SIGNAL, signal->header.type);
+    EXPECT_EQ(2u, signal->value);
+
+    // Timeline fence is passed to kernel driver only with the submission
+    const auto &handles = jobs[1]->getCommandBuffers()[0]->getBufferHandles();
+    ASSERT_EQ(handles.size() + 1, osInfc.submittedBufferHandles.size());
+    EXPECT_TRUE(std::equal(handles.begin(), handles.end(), osInfc.submittedBufferHandles.begin()));
+
+    // Only the first query asks kernel driver, the next ones compare the timeline fence
+    osInfc.waitBusy = true;
+    osInfc.callCntWait = 0;
+    EXPECT_FALSE(jobs[0]->waitForCompletion(0));
+    EXPECT_EQ(1u, osInfc.callCntWait);
+    EXPECT_FALSE(jobs[0]->waitForCompletion(0));
+    EXPECT_EQ(1u, osInfc.callCntWait);
+    osInfc.waitBusy = false;
+
+    // Device signals completion of the first job, kernel driver is not asked anymore
+    *fence = 1;
+    EXPECT_TRUE(jobs[0]->isTimelineSignaled());
+    EXPECT_FALSE(jobs[1]->isTimelineSignaled());
+    EXPECT_TRUE(jobs[0]->waitForCompletion(0));
+    EXPECT_EQ(1u, osInfc.callCntWait);
+    EXPECT_TRUE(jobs[0]->isSuccess());
+
+    jobs.clear();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
+}
+
+TEST_F(VPUDeviceTest, jobCompletedDuringSpinIsNotWaitedForInKernelDriver) {
+    auto tsDest = ctx->createSharedMemAlloc(4096);
+    ASSERT_NE(nullptr, tsDest);
+
+    auto job = createJob(tsDest);
+    EXPECT_TRUE(queue->submit(job.get()));
+    ASSERT_TRUE(job->isTimelineTracked());
+
+    auto savedConfig = SpinWait::getConfig();
+    SpinWait::Config config;
+    config.spinTime = std::chrono::seconds(10);
+    SpinWait::setConfig(config);
+
+    // Kernel driver wait would time out, completion is seen only in the timeline fence
+    osInfc.waitBusy = true;
+    osInfc.callCntWait = 0;
+    std::thread device([&] { *job->getTimelineFence() = job->getTimelineValue(); });
+    EXPECT_TRUE(job->waitForCompletion(std::numeric_limits<int64_t>::max()));
+    device.join();
+    EXPECT_EQ(0u, osInfc.callCntWait);
+    EXPECT_TRUE(job->isSuccess());
+    osInfc.waitBusy = false;
+    SpinWait::setConfig(savedConfig);
+
+    job.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
+}
+
+TEST_F(VPUDeviceTest, resubmittedJobInFlightIsNotTrackedByTimelineFence) {
+    auto tsDest = ctx->createSharedMemAlloc(4096);
+    ASSERT_NE(nullptr, tsDest);
+
+    auto job = createJob(tsDest);
+    EXPECT_TRUE(queue->submit(job.get()));
+    ASSERT_TRUE(job->isTimelineTracked());
+
+    // Previous submission is still running, signal is turned away from the timeline fence
+    EXPECT_TRUE(queue->submit(job.get()));
+    EXPECT_FALSE(job->isTimelineTracked());
+    EXPECT_EQ(1u, queue->getTimelineValue());
+
+    const auto &cmdBuffer = *job->getCommandBuffers()[0];
+    EXPECT_EQ(cmdBuffer.getBuffer()->getVPUAddr() +
+                  offsetof(VPUCommandBuffer::CommandHeader, timelineValue),
+              getTimelineSignal(cmdBuffer)->offset);
+
+    // Kernel driver reports the untracked submission as completed
+    osInfc.callCntWait = 0;
+    EXPECT_TRUE(queue->submit(job.get()));
+    EXPECT_EQ(1u, osInfc.callCntWait);
+    ASSERT_TRUE(job->isTimelineTracked());
+    EXPECT_EQ(2u, job->getTimelineValue());
+    EXPECT_EQ(2u, getTimelineSignal(cmdBuffer)->value);
 
+    job.reset();
     EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
 }
 
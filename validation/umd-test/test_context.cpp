@@ -7,6 +7,7 @@
 
 #include "graph_utilities.hpp"
 #include "umd_test.h"
+#include "zex_context.hpp"
 
 #include <functional>
 #include <gtest/gtest.h>
@@ -43,6 +44,35 @@ TEST_F(Context, CreateContextRepeat) {
     }
 }
 
+TEST_F(Context, QueryMemoryUsageCounters) {
+    decltype(zexContextGetMemoryUsage) *contextGetMemoryUsage = nullptr;
+    ASSERT_EQ(zeDriverGetExtensionFunctionAddress(
+                  zeDriver,
+                  "zexContextGetMemoryUsage",
+                  reinterpret_cast<void **>(&contextGetMemoryUsage)),
+              ZE_RESULT_SUCCESS);
+
+    zex_memory_usage_t before = {};
+    ASSERT_EQ(contextGetMemoryUsage(zeContext, &before), ZE_RESULT_SUCCESS);
+
+    const size_t allocSize = 64 * 1024;
+    auto mem = zeMemory::allocHost(zeContext, allocSize);
+
+    zex_memory_usage_t after = {};
+    ASSERT_EQ(contextGetMemoryUsage(zeContext, &after), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(after.total.count, before.total.count + 1);
+    EXPECT_GE(after.total.allocated, before.total.allocated + allocSize);
+    EXPECT_GE(after.total.allocatedPeak, after.total.allocated);
+    EXPECT_EQ(after.location[ZEX_MEMORY_LOCATION_HOST].count,
+              before.location[ZEX_MEMORY_LOCATION_HOST].count + 1);
+
+    mem.reset();
+
+    ASSERT_EQ(contextGetMemoryUsage(zeContext, &after), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(after.total.count, before.total.count);
+    EXPECT_GE(after.total.allocatedPeak, before.total.allocated + allocSize);
+}
+
 class MultiContext : public Context, public ::testing::WithParamInterface<uint32_t> {
   public:
     void SetUp() override {
@@ -8,6 +8,7 @@
 #include "frame_counter.hpp"
 #include "umd_test.h"
 #include "utilities/data_handle.h"
+#include "zex_memory.hpp"
 
 #include <algorithm>
 #include <memory>
@@ -103,6 +104,23 @@ TEST_P(MemoryAllocation, AllocHostMemory) {
     ASSERT_TRUE(mem.get()) << "Failed to allocate host memory using size " << size;
 }
 
+TEST_F(MemoryAllocation, AllocHostMemoryPrefaulted) {
+    const size_t size = 16 * MB;
+    zex_mem_alloc_prefault_desc_t prefaultDesc = {
+        .stype = ZEX_STRUCTURE_TYPE_MEM_ALLOC_PREFAULT_DESC,
+        .pNext = nullptr};
+    ze_host_mem_alloc_desc_t desc = {.stype = ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC,
+                                     .pNext = &prefaultDesc,
+                                     .flags = 0};
+    ze_result_t ret;
+    auto mem = zeScope::memAllocHost(zeContext, desc, size, 0, ret);
+    ASSERT_EQ(ret, ZE_RESULT_SUCCESS);
+    ASSERT_TRUE(mem.get());
+
+    memset(mem.get(), 0xab, size);
+    EXPECT_EQ(static_cast<uint8_t *>(mem.get())[size - 1], 0xab);
+}
+
 TEST_F(MemoryAllocation, QueryContextMemory) {
     uint64_t size = 48 * KB;
     auto mem = AllocHostMemory(size);